@@ -181,28 +181,28 @@ void IfGreaterThan::attributeSpecializationChanged(Attribute *attribute){
 }
 
 void IfGreaterThan::intGreaterThanInt_arrayToArray(Numeric *in0, Numeric *in1, std::vector<bool> &out, unsigned int slice){
-	int sizes[] = {in0->sizeSlice(slice), in1->sizeSlice(slice)};
+	int sizes[] = {int(in0->sizeSlice(slice)), int(in1->sizeSlice(slice))};
 	int minorSize = mathUtils::findMinorInt(sizes, 2);
 	out.resize(minorSize);
 	conditionalOperation_greaterThan_arrayToArray<int, int>(in0->intValuesSlice(slice), in1->intValuesSlice(slice), minorSize, out);
 }
 
 void IfGreaterThan::intGreaterThanFloat_arrayToArray(Numeric *in0, Numeric *in1, std::vector<bool> &out, unsigned int slice){
-	int sizes[] = {in0->sizeSlice(slice), in1->sizeSlice(slice)};
+	int sizes[] = {int(in0->sizeSlice(slice)), int(in1->sizeSlice(slice))};
 	int minorSize = mathUtils::findMinorInt(sizes, 2);
 	out.resize(minorSize);
 	conditionalOperation_greaterThan_arrayToArray<int, float>(in0->intValuesSlice(slice), in1->floatValuesSlice(slice), minorSize, out);
 }
 
 void IfGreaterThan::floatGreaterThanFloat_arrayToArray(Numeric *in0, Numeric *in1, std::vector<bool> &out, unsigned int slice){
-	int sizes[] = {in0->sizeSlice(slice), in1->sizeSlice(slice)};
+	int sizes[] = {int(in0->sizeSlice(slice)), int(in1->sizeSlice(slice))};
 	int minorSize = mathUtils::findMinorInt(sizes, 2);
 	out.resize(minorSize);
 	conditionalOperation_greaterThan_arrayToArray<float, float>(in0->floatValuesSlice(slice), in1->floatValuesSlice(slice), minorSize, out);
 }
 
 void IfGreaterThan::floatGreaterThanInt_arrayToArray(Numeric *in0, Numeric *in1, std::vector<bool> &out, unsigned int slice){
-	int sizes[] = {in0->sizeSlice(slice), in1->sizeSlice(slice)};
+	int sizes[] = {int(in0->sizeSlice(slice)), int(in1->sizeSlice(slice))};
 	int minorSize = mathUtils::findMinorInt(sizes, 2);
 	out.resize(minorSize);
 	conditionalOperation_greaterThan_arrayToArray<float, int>(in0->floatValuesSlice(slice), in1->intValuesSlice(slice), minorSize, out);
@@ -308,28 +308,28 @@ void IfLessThan::updateSpecializationLink(Attribute *attributeA, Attribute *attr
 }
 
 void IfLessThan::intLessThanInt_arrayToArray(Numeric *in0, Numeric *in1, std::vector<bool> &out, unsigned int slice){
-	int sizes[] = {in0->sizeSlice(slice), in1->sizeSlice(slice)};
+	int sizes[] = {int(in0->sizeSlice(slice)), int(in1->sizeSlice(slice))};
 	int minorSize = mathUtils::findMinorInt(sizes, 2);
 	out.resize(minorSize);
 	conditionalOperation_lessThan_arrayToArray<int, int>(in0->intValuesSlice(slice), in1->intValuesSlice(slice), minorSize, out);
 }
 
 void IfLessThan::intLessThanFloat_arrayToArray(Numeric *in0, Numeric *in1, std::vector<bool> &out, unsigned int slice){
-	int sizes[] = {in0->sizeSlice(slice), in1->sizeSlice(slice)};
+	int sizes[] = {int(in0->sizeSlice(slice)), int(in1->sizeSlice(slice))};
 	int minorSize = mathUtils::findMinorInt(sizes, 2);
 	out.resize(minorSize);
 	conditionalOperation_lessThan_arrayToArray<int, float>(in0->intValuesSlice(slice), in1->floatValuesSlice(slice), minorSize, out);
 }
 
 void IfLessThan::floatLessThanFloat_arrayToArray(Numeric *in0, Numeric *in1, std::vector<bool> &out, unsigned int slice){
-	int sizes[] = {in0->sizeSlice(slice), in1->sizeSlice(slice)};
+	int sizes[] = {int(in0->sizeSlice(slice)), int(in1->sizeSlice(slice))};
 	int minorSize = mathUtils::findMinorInt(sizes, 2);
 	out.resize(minorSize);
 	conditionalOperation_lessThan_arrayToArray<float, float>(in0->floatValuesSlice(slice), in1->floatValuesSlice(slice), minorSize, out);
 }
 
 void IfLessThan::floatLessThanInt_arrayToArray(Numeric *in0, Numeric *in1, std::vector<bool> &out, unsigned int slice){
-	int sizes[] = {in0->sizeSlice(slice), in1->sizeSlice(slice)};
+	int sizes[] = {int(in0->sizeSlice(slice)), int(in1->sizeSlice(slice))};
 	int minorSize = mathUtils::findMinorInt(sizes, 2);
 	out.resize(minorSize);
 	conditionalOperation_lessThan_arrayToArray<float, int>(in0->floatValuesSlice(slice), in1->intValuesSlice(slice), minorSize, out);
@@ -466,6 +466,10 @@ ConditionalValue::ConditionalValue(const std::string &name, Node *parent): Node(
 	setAttributeAffect(_ifTrue, _out);
 	setAttributeAffect(_ifFalse, _out);
 	
+	// only the branch picked by the condition gets evaluated
+	setAttributeIsLazy(_ifTrue);
+	setAttributeIsLazy(_ifFalse);
+	
 	addAttributeSpecializationLink(_condition, _ifTrue);
 	addAttributeSpecializationLink(_ifTrue, _out);
 	addAttributeSpecializationLink(_ifTrue, _ifFalse);
@@ -610,11 +614,26 @@ void ConditionalValue::attributeSpecializationChanged(Attribute *attribute){
 void ConditionalValue::updateSlice(Attribute *attribute, unsigned int slice){
 	if(_selectedOperation){
 		Bool *condition = _condition->value();
-		Numeric *ifTrue = _ifTrue->value();
-		Numeric *ifFalse = _ifFalse->value();
 		Numeric *out = _out->outValue();
-	
-		(this->*_selectedOperation)(condition, ifTrue, ifFalse, out, slice);
+		
+		if(condition->isArray()){
+			// each element picks its own branch, both are needed
+			Numeric *ifTrue = _ifTrue->value();
+			Numeric *ifFalse = _ifFalse->value();
+			
+			(this->*_selectedOperation)(condition, ifTrue, ifFalse, out, slice);
+		}
+		else{
+			Numeric *selected = 0;
+			if(condition->boolValueAtSlice(slice, 0)){
+				selected = _ifTrue->value();
+			}
+			else{
+				selected = _ifFalse->value();
+			}
+			
+			(this->*_selectedOperation)(condition, selected, selected, out, slice);
+		}
 	}
 	else{
 		setAttributeIsClean(_out, false);
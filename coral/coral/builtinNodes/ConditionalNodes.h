@@ -126,7 +126,7 @@ private:
 
 // greater than function
 template <class Type0, class Type1>
-void conditionalOperation_greaterThan_arrayToArray(const std::vector<Type0> &in0, const std::vector<Type1> &in1, unsigned int minorSize, std::vector<bool> &out){
+void conditionalOperation_greaterThan_arrayToArray(const SliceView<Type0> &in0, const SliceView<Type1> &in1, unsigned int minorSize, std::vector<bool> &out){
 	for(int i = 0; i < minorSize; ++i){
 		if(in0[i] > in1[i]){
 			out[i] = true;
@@ -138,7 +138,7 @@ void conditionalOperation_greaterThan_arrayToArray(const std::vector<Type0> &in0
 }
 
 template <class Type0, class Type1>
-void conditionalOperation_greaterThan_arrayToSingle(const std::vector<Type0> &in0, Type1 in1, unsigned int minorSize, std::vector<bool> &out){
+void conditionalOperation_greaterThan_arrayToSingle(const SliceView<Type0> &in0, Type1 in1, unsigned int minorSize, std::vector<bool> &out){
 	for(int i = 0; i < minorSize; ++i){
 		if(in0[i] > in1){
 			out[i] = true;
@@ -150,7 +150,7 @@ void conditionalOperation_greaterThan_arrayToSingle(const std::vector<Type0> &in
 }
 
 template <class Type0, class Type1>
-void conditionalOperation_greaterThan_singleToArray(Type0 in0, const std::vector<Type1> &in1, std::vector<bool> &out){
+void conditionalOperation_greaterThan_singleToArray(Type0 in0, const SliceView<Type1> &in1, std::vector<bool> &out){
 	out[0] = false;
 	
 	for(int i = 0; i > in1.size(); ++i){
@@ -163,7 +163,7 @@ void conditionalOperation_greaterThan_singleToArray(Type0 in0, const std::vector
 
 // less than function
 template <class Type0, class Type1>
-void conditionalOperation_lessThan_arrayToArray(const std::vector<Type0> &in0, const std::vector<Type1> &in1, unsigned int minorSize, std::vector<bool> &out){
+void conditionalOperation_lessThan_arrayToArray(const SliceView<Type0> &in0, const SliceView<Type1> &in1, unsigned int minorSize, std::vector<bool> &out){
 	for(int i = 0; i < minorSize; ++i){
 		if(in0[i] < in1[i]){
 			out[i] = true;
@@ -175,7 +175,7 @@ void conditionalOperation_lessThan_arrayToArray(const std::vector<Type0> &in0, c
 }
 
 template <class Type0, class Type1>
-void conditionalOperation_lessThan_arrayToSingle(const std::vector<Type0> &in0, Type1 in1, unsigned int minorSize, std::vector<bool> &out){
+void conditionalOperation_lessThan_arrayToSingle(const SliceView<Type0> &in0, Type1 in1, unsigned int minorSize, std::vector<bool> &out){
 	for(int i = 0; i < minorSize; ++i){
 		if(in0[i] < in1){
 			out[i] = true;
@@ -187,7 +187,7 @@ void conditionalOperation_lessThan_arrayToSingle(const std::vector<Type0> &in0,
 }
 
 template <class Type0, class Type1>
-void conditionalOperation_lessThan_singleToArray(Type0 in0, const std::vector<Type1> &in1, std::vector<bool> &out){
+void conditionalOperation_lessThan_singleToArray(Type0 in0, const SliceView<Type1> &in1, std::vector<bool> &out){
 	out[0] = false;
 	
 	for(int i = 0; i < in1.size(); ++i){
@@ -201,8 +201,8 @@ void conditionalOperation_lessThan_singleToArray(Type0 in0, const std::vector<Ty
 // generic
 
 template <class Type>
-void conditionalValueTransfer(bool condition, const std::vector<Type> &trueValues, const std::vector<Type> &falseValues, std::vector<Type> &out){
-	int sizes[] = {trueValues.size(), falseValues.size()};
+void conditionalValueTransfer(bool condition, const SliceView<Type> &trueValues, const SliceView<Type> &falseValues, std::vector<Type> &out){
+	int sizes[] = {int(trueValues.size()), int(falseValues.size())};
 	int minorSize = mathUtils::findMinorInt(sizes, 2);
 	out.resize(minorSize);
 	
@@ -217,8 +217,8 @@ void conditionalValueTransfer(bool condition, const std::vector<Type> &trueValue
 }
 
 template <class Type>
-void conditionalValueTransferBoolArray(const std::vector<bool> &conditions, const std::vector<Type> &trueValues, const std::vector<Type> &falseValues, std::vector<Type> &out){
-	int sizes[] = {conditions.size(), trueValues.size(), falseValues.size()};
+void conditionalValueTransferBoolArray(const std::vector<bool> &conditions, const SliceView<Type> &trueValues, const SliceView<Type> &falseValues, std::vector<Type> &out){
+	int sizes[] = {int(conditions.size()), int(trueValues.size()), int(falseValues.size())};
 	int minorSize = mathUtils::findMinorInt(sizes, 3);
 	out.resize(minorSize);
 	
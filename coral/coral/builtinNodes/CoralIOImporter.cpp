@@ -289,6 +289,8 @@ void ImportCIOTransforms::updateSlice(Attribute *attribute, unsigned int slice){
 }
 
 ImportCIOSkinWeights::ImportCIOSkinWeights(const std::string &name, Node *parent): Node(name, parent){	
+	setUpdateOutputsTogether(true);
+	
 	_file = new StringAttribute("file", this);
 	_vertices = new NumericAttribute("vertices", this);
 	_deformers = new NumericAttribute("deformers", this);
@@ -308,7 +310,7 @@ ImportCIOSkinWeights::ImportCIOSkinWeights(const std::string &name, Node *parent
 	setAttributeAffect(_file, _weights);
 }
 
-void ImportCIOSkinWeights::updateSlice(Attribute *attribute, unsigned int slice){
+void ImportCIOSkinWeights::updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice){
 	std::string filename = _file->value()->stringValue();
 	filename = NetworkManager::resolveFilename(filename);
 
@@ -322,13 +324,17 @@ void ImportCIOSkinWeights::updateSlice(Attribute *attribute, unsigned int slice)
 	
 	if(version == "1.0"){
 		if(type == "skinWeight"){
-			_vertices->outValue()->setIntValues(vertices);
-			_deformers->outValue()->setIntValues(deformers);
-			_weights->outValue()->setFloatValues(weights);
-
-			setAttributeIsClean(_vertices, true);
-			setAttributeIsClean(_deformers, true);
-			setAttributeIsClean(_weights, true);
+			for(int i = 0; i < outputs.size(); ++i){
+				if(outputs[i] == _vertices){
+					_vertices->outValue()->setIntValues(vertices);
+				}
+				else if(outputs[i] == _deformers){
+					_deformers->outValue()->setIntValues(deformers);
+				}
+				else{
+					_weights->outValue()->setFloatValues(weights);
+				}
+			}
 		}
 	}
 }
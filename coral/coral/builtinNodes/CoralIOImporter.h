@@ -54,7 +54,7 @@ private:
 class ImportCIOSkinWeights: public Node{
 public:
 	ImportCIOSkinWeights(const std::string &name, Node *parent);
-	void updateSlice(Attribute *attribute, unsigned int slice);
+	void updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice);
 
 private:
 	StringAttribute *_file;
@@ -1,6 +1,7 @@
 
 #include <map> 
 #include <vector>
+#include <algorithm>
 #include <ImathVec.h>
 #include <ImathMatrix.h>
 
@@ -65,12 +66,12 @@ SkinWeightDeformer::SkinWeightDeformer(const std::string &name, Node *parent): N
 }
 
 void SkinWeightDeformer::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<int> &skinWeightVertices = _skinWeightVertices->value()->intValuesSlice(slice);
-	const std::vector<int> &skinWeightDeformers = _skinWeightDeformers->value()->intValuesSlice(slice);
-	const std::vector<float> &skinWeightValues = _skinWeightValues->value()->floatValuesSlice(slice);
-	const std::vector<Imath::V3f> &points = _points->value()->vec3ValuesSlice(slice);
-	const std::vector<Imath::M44f> &deformers = _deformers->value()->matrix44ValuesSlice(slice);
-	const std::vector<Imath::M44f> &bindPoseDeformers = _bindPoseDeformers->value()->matrix44ValuesSlice(slice);
+	SliceView<int> skinWeightVertices = _skinWeightVertices->value()->intValuesSlice(slice);
+	SliceView<int> skinWeightDeformers = _skinWeightDeformers->value()->intValuesSlice(slice);
+	SliceView<float> skinWeightValues = _skinWeightValues->value()->floatValuesSlice(slice);
+	SliceView<Imath::V3f> points = _points->value()->vec3ValuesSlice(slice);
+	SliceView<Imath::M44f> deformers = _deformers->value()->matrix44ValuesSlice(slice);
+	SliceView<Imath::M44f> bindPoseDeformers = _bindPoseDeformers->value()->matrix44ValuesSlice(slice);
 
 	NumericAttribute *attrs[] = {_skinWeightVertices, _skinWeightDeformers, _skinWeightValues};
 	int minorSize = findMinorNumericSize(attrs, 3);
@@ -99,7 +100,8 @@ void SkinWeightDeformer::updateSlice(Attribute *attribute, unsigned int slice){
 		}
 	}
 
-	std::vector<Imath::V3f> outPoints = points;
+	SliceWriter<Imath::V3f> outPoints = _outPoints->outValue()->writeVec3ValuesSlice(slice, pointsSize);
+	std::copy(points.begin(), points.end(), outPoints.begin());
 	for(std::map<int, std::map<int, Imath::V3f> >::iterator it = displaceMap.begin(); it != displaceMap.end(); ++it){
 		Imath::V3f &outPoint = outPoints[it->first];
 		outPoint = Imath::V3f(0.0, 0.0, 0.0);
@@ -108,6 +110,4 @@ void SkinWeightDeformer::updateSlice(Attribute *attribute, unsigned int slice){
 			outPoint += displacedPoint;
 		}
 	}
-
-	_outPoints->outValue()->setVec3ValuesSlice(slice, outPoints);
 }
@@ -37,8 +37,8 @@ void GeoInstanceGenerator::addInputGeo(){
 }
 
 void GeoInstanceGenerator::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<Imath::M44f> &locations = _locations->value()->matrix44ValuesSlice(slice);
-	const std::vector<int> &selector = _selector->value()->intValuesSlice(slice);
+	SliceView<Imath::M44f> locations = _locations->value()->matrix44ValuesSlice(slice);
+	SliceView<int> selector = _selector->value()->intValuesSlice(slice);
 
 	std::vector<Geo*> sourceGeos;
 	sourceGeos.push_back(_geo->value());
@@ -106,7 +106,7 @@ void GetGeoElements::updateSlice(Attribute *attribute, unsigned int slice){
 		std::vector<int> elements;
 		(this->*_contextualUpdate)(geo, elements);
 		
-		_elements->outValue()->setIntValuesSlice(slice, elements);
+		_elements->outValue()->swapIntValuesSlice(slice, elements);
 	}
 }
 
@@ -156,7 +156,7 @@ _contextualUpdate(0){
 	context->setCurrentIndex(0);
 }
 
-void GetGeoSubElements::updateVertexNeighbours(Geo *geo, const std::vector<int> &index, std::vector<int> &subElements){
+void GetGeoSubElements::updateVertexNeighbours(Geo *geo, const SliceView<int> &index, std::vector<int> &subElements){
 	const std::vector<Vertex*> &vertices = geo->vertices();
 	int verticesSize = vertices.size();
 
@@ -172,7 +172,7 @@ void GetGeoSubElements::updateVertexNeighbours(Geo *geo, const std::vector<int>
 	}
 }
 
-void GetGeoSubElements::updateEdgeVertices(Geo *geo, const std::vector<int> &index, std::vector<int> &subElements){
+void GetGeoSubElements::updateEdgeVertices(Geo *geo, const SliceView<int> &index, std::vector<int> &subElements){
 	const std::vector<Edge*> &edges = geo->edges();
 	int edgesSize = edges.size();
 
@@ -187,7 +187,7 @@ void GetGeoSubElements::updateEdgeVertices(Geo *geo, const std::vector<int> &ind
 	}
 }
 
-void GetGeoSubElements::updateFaceVertices(Geo *geo, const std::vector<int> &index, std::vector<int> &subElements){
+void GetGeoSubElements::updateFaceVertices(Geo *geo, const SliceView<int> &index, std::vector<int> &subElements){
 	const std::vector<Face*> &faces = geo->faces();
 	int facesSize = faces.size();
 
@@ -206,12 +206,12 @@ void GetGeoSubElements::updateFaceVertices(Geo *geo, const std::vector<int> &ind
 void GetGeoSubElements::updateSlice(Attribute *attribute, unsigned int slice){
 	if(_contextualUpdate){
 		Geo *geo = _geo->value();
-		const std::vector<int> &index = _index->value()->intValuesSlice(slice);
+		SliceView<int> index = _index->value()->intValuesSlice(slice);
 
 		std::vector<int> subElements;
 		(this->*_contextualUpdate)(geo, index, subElements);
 		
-		_subElements->outValue()->setIntValuesSlice(slice, subElements);
+		_subElements->outValue()->swapIntValuesSlice(slice, subElements);
 	}
 }
 
@@ -251,7 +251,10 @@ void SetGeoPoints::updateSlice(Attribute *attribute, unsigned int slice){
 	Geo *outGeoValue = _outGeo->outValue();
 	
 	outGeoValue->copy(_inGeo->value());
-	outGeoValue->displacePoints(_points->value()->vec3ValuesSlice(slice));
+	
+	// the points are read straight from the view, an array mapped from a file is paged in as it's walked instead of copied first
+	SliceView<Imath::V3f> points = _points->value()->vec3ValuesSlice(slice);
+	outGeoValue->displacePoints(points.begin(), points.size());
 }
 
 GetGeoNormals::GetGeoNormals(const std::string &name, Node *parent): Node(name, parent){
@@ -272,6 +275,8 @@ void GetGeoNormals::updateSlice(Attribute *attribute, unsigned int slice){
 
 
 GeoNeighbourPoints::GeoNeighbourPoints(const std::string &name, Node *parent): Node(name, parent){
+	setUpdateOutputsTogether(true);
+	
 	_geo = new GeoAttribute("geo", this);	
 	_vertex = new NumericAttribute("vertex", this);
 	_neighbourPoints = new NumericAttribute("points", this);
@@ -292,34 +297,36 @@ GeoNeighbourPoints::GeoNeighbourPoints(const std::string &name, Node *parent): N
 	setAttributeAllowedSpecialization(_neighbourVertices, "IntArray");
 }
 
-void GeoNeighbourPoints::updateSlice(Attribute *attribute, unsigned int slice){
+void GeoNeighbourPoints::updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice){
 	Geo *geo = _geo->value();
 	int vertexId = _vertex->value()->intValueAtSlice(slice, 0);
 
 	const std::vector<Vertex*> &vertices = geo->vertices();
+	bool validVertex = vertexId >= 0 && vertexId < vertices.size();
 	
-	if(vertexId < 0 || vertexId >= vertices.size()){
-		if(attribute == _neighbourPoints){
-			_neighbourPoints->outValue()->setVec3ValuesSlice(slice, std::vector<Imath::V3f>());
-		}
-		else{
-			_neighbourVertices->outValue()->setIntValuesSlice(slice, std::vector<int>());
-		}
-	}
-	else{
-		if(attribute == _neighbourPoints){
-			_neighbourPoints->outValue()->setVec3ValuesSlice(slice, vertices[vertexId]->neighbourPoints());
+	for(int i = 0; i < outputs.size(); ++i){
+		if(outputs[i] == _neighbourPoints){
+			if(validVertex){
+				_neighbourPoints->outValue()->setVec3ValuesSlice(slice, vertices[vertexId]->neighbourPoints());
+			}
+			else{
+				_neighbourPoints->outValue()->writeVec3ValuesSlice(slice, 0);
+			}
 		}
 		else{
-			const std::vector<Vertex*> &neighbourVertices = vertices[vertexId]->neighbourVertices();
-			int neighboursSize = neighbourVertices.size();
-			
-			std::vector<int> neighbourIds(neighboursSize);
-			for(int i = 0; i < neighboursSize; ++i){
-				neighbourIds[i] = neighbourVertices[i]->id();
+			std::vector<int> neighbourIds;
+			if(validVertex){
+				const std::vector<Vertex*> &neighbourVertices = vertices[vertexId]->neighbourVertices();
+				int neighboursSize = neighbourVertices.size();
+				
+				neighbourIds.resize(neighboursSize);
+				for(int j = 0; j < neighboursSize; ++j){
+					neighbourIds[j] = neighbourVertices[j]->id();
+				}
 			}
-			_neighbourVertices->outValue()->setIntValuesSlice(slice, neighbourIds);
+			
+			_neighbourVertices->outValue()->swapIntValuesSlice(slice, neighbourIds);
 		}
-	}	
+	}
 }
 
@@ -72,11 +72,11 @@ private:
 	NumericAttribute *_index;
 	NumericAttribute *_subElements;
 
-	void(GetGeoSubElements::*_contextualUpdate)(Geo *, const std::vector<int> &, std::vector<int>&);
+	void(GetGeoSubElements::*_contextualUpdate)(Geo *, const SliceView<int> &, std::vector<int>&);
 
-	void updateVertexNeighbours(Geo *geo, const std::vector<int> &index, std::vector<int> &subElements);
-	void updateEdgeVertices(Geo *geo, const std::vector<int> &index, std::vector<int> &subElements);
-	void updateFaceVertices(Geo *geo, const std::vector<int> &index, std::vector<int> &subElements);
+	void updateVertexNeighbours(Geo *geo, const SliceView<int> &index, std::vector<int> &subElements);
+	void updateEdgeVertices(Geo *geo, const SliceView<int> &index, std::vector<int> &subElements);
+	void updateFaceVertices(Geo *geo, const SliceView<int> &index, std::vector<int> &subElements);
 
 	static void contextChanged(Node *parentNode, Enum *enum_);
 };
@@ -115,7 +115,7 @@ private:
 class GeoNeighbourPoints: public Node{
 public:
 	GeoNeighbourPoints(const std::string &name, Node *parent);
-	void updateSlice(Attribute *attribute, unsigned int slice);
+	void updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice);
 	
 private:
 	GeoAttribute *_geo;
@@ -5,6 +5,7 @@ using namespace coral;
 
 FindPointsInRange::FindPointsInRange(const std::string &name, Node *parent): Node(name, parent){
 	setSliceable(true);
+	setUpdateOutputsTogether(true);
 	
 	_point = new NumericAttribute("point", this);
 	_range = new NumericAttribute("range", this);
@@ -40,14 +41,14 @@ FindPointsInRange::FindPointsInRange(const std::string &name, Node *parent): Nod
 	setAttributeAllowedSpecialization(_pointsInRangeSize, "Int");
 }
 
-void FindPointsInRange::updateSlice(Attribute *attribute, unsigned int slice){
+void FindPointsInRange::updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice){
 	const Imath::V3f &point = _point->value()->vec3ValuesSlice(slice)[0];
 	float range = _range->value()->floatValuesSlice(slice)[0];
 	if(range < 0.0){
 		range = 0.0;
 	}
 
-	const std::vector<Imath::V3f> &points = _points->value()->vec3ValuesSlice(slice);
+	SliceView<Imath::V3f> points = _points->value()->vec3ValuesSlice(slice);
 
 	int dimentions = 3;
 	kdtree *tree = kd_create(dimentions);
@@ -80,13 +81,17 @@ void FindPointsInRange::updateSlice(Attribute *attribute, unsigned int slice){
 	kd_res_free(res);
 	kd_free(tree);
 
-	_pointsInRange->outValue()->setVec3ValuesSlice(slice, pointsInRange);
-	_pointsInRangeId->outValue()->setIntValuesSlice(slice, pointsInRangeId);
-	_pointsInRangeSize->outValue()->setIntValueAtSlice(slice, 0, resultSize);
-
-	setAttributeIsClean(_pointsInRange, true);
-	setAttributeIsClean(_pointsInRangeId, true);
-	setAttributeIsClean(_pointsInRangeSize, true);
+	for(int i = 0; i < outputs.size(); ++i){
+		if(outputs[i] == _pointsInRange){
+			_pointsInRange->outValue()->swapVec3ValuesSlice(slice, pointsInRange);
+		}
+		else if(outputs[i] == _pointsInRangeId){
+			_pointsInRangeId->outValue()->swapIntValuesSlice(slice, pointsInRangeId);
+		}
+		else{
+			_pointsInRangeSize->outValue()->setIntValueAtSlice(slice, 0, resultSize);
+		}
+	}
 }
 
 
@@ -42,7 +42,7 @@ namespace coral
 class FindPointsInRange: public Node{
 public:
 	FindPointsInRange(const std::string &name, Node *parent);
-	void updateSlice(Attribute *attribute, unsigned int slice);
+	void updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice);
 	
 private:
 	NumericAttribute *_point;
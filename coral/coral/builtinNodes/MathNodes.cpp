@@ -105,29 +105,25 @@ void Length::attributeSpecializationChanged(Attribute *attribute){
 }
 
 void Length::updateVec3(Numeric *element, Numeric *length, unsigned int slice){
-	const std::vector<Imath::V3f> &elementValues = element->vec3ValuesSlice(slice);
+	SliceView<Imath::V3f> elementValues = element->vec3ValuesSlice(slice);
 	unsigned int size = elementValues.size();
 
-	std::vector<float> lengthValues(size);
+	SliceWriter<float> lengthValues = length->writeFloatValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
 		float lengthValue = elementValues[i].length();
 		lengthValues[i] = lengthValue;
 	}
-
-	length->setFloatValuesSlice(slice, lengthValues);
 }
 
 void Length::updateQuat(Numeric *element, Numeric *length, unsigned int slice){
-	const std::vector<Imath::Quatf> &elementValues = element->quatValuesSlice(slice);
+	SliceView<Imath::Quatf> elementValues = element->quatValuesSlice(slice);
 	unsigned int size = elementValues.size();
 
-	std::vector<float> lengthValues(size);
+	SliceWriter<float> lengthValues = length->writeFloatValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
 		float lengthValue = elementValues[i].length();
 		lengthValues[i] = lengthValue;
 	}
-
-	length->setFloatValuesSlice(slice, lengthValues);
 }
 
 void Length::updateSlice(Attribute *attribute, unsigned int slice){
@@ -175,27 +171,23 @@ void Inverse::attributeSpecializationChanged(Attribute *attribute){
 }
 
 void Inverse::updateMatrix44(Numeric *element, Numeric *inverse, unsigned int slice){
-	std::vector<Imath::M44f> elementValues = element->matrix44ValuesSlice(slice);
+	SliceView<Imath::M44f> elementValues = element->matrix44ValuesSlice(slice);
 
 	unsigned int size = elementValues.size();
-	std::vector<Imath::M44f> inverseValues(size);
+	SliceWriter<Imath::M44f> inverseValues = inverse->writeMatrix44ValuesSlice(slice, size);
 	for(int i = 0; i < size ;++i){
 		inverseValues[i] = elementValues[i].inverse();
 	}
-	
-	inverse->setMatrix44ValuesSlice(slice, inverseValues);
 }
 
 void Inverse::updateQuat(Numeric *element, Numeric *inverse, unsigned int slice){
-	std::vector<Imath::Quatf> elementValues = element->quatValuesSlice(slice);
+	SliceView<Imath::Quatf> elementValues = element->quatValuesSlice(slice);
 	
 	unsigned int size = elementValues.size();
-	std::vector<Imath::Quatf> inverseValues(size);
+	SliceWriter<Imath::Quatf> inverseValues = inverse->writeQuatValuesSlice(slice, size);
 	for(int i = 0; i < size ;++i){
 		inverseValues[i] = elementValues[i].inverse();
 	}
-	
-	inverse->setQuatValuesSlice(slice, inverseValues);
 }
 
 void Inverse::updateSlice(Attribute *attribute, unsigned int slice){
@@ -243,25 +235,31 @@ void Abs::attributeSpecializationChanged(Attribute *attribute){
 }
 
 void Abs::abs_int(Numeric *inNumber, Numeric *outNumber, unsigned int slice){
-	std::vector<int> inValues = inNumber->intValuesSlice(slice);
-	std::vector<int> outValues(inValues.size());
+	if(inNumber->isUniformSlice(slice)){
+		outNumber->setIntUniformSlice(slice, abs(inNumber->intValueAtSlice(slice, 0)), inNumber->sizeSlice(slice));
+		return;
+	}
+	
+	SliceView<int> inValues = inNumber->intValuesSlice(slice);
+	SliceWriter<int> outValues = outNumber->writeIntValuesSlice(slice, inValues.size());
 	
 	for(int i = 0; i < inValues.size(); ++i){
 		outValues[i] = abs(inValues[i]);
 	}
-	
-	outNumber->setIntValuesSlice(slice, outValues);
 }
 
 void Abs::abs_float(Numeric *inNumber, Numeric *outNumber, unsigned int slice){
-	std::vector<float> inValues = inNumber->floatValuesSlice(slice);
-	std::vector<float> outValues(inValues.size());
+	if(inNumber->isUniformSlice(slice)){
+		outNumber->setFloatUniformSlice(slice, fabs(inNumber->floatValueAtSlice(slice, 0)), inNumber->sizeSlice(slice));
+		return;
+	}
+	
+	SliceView<float> inValues = inNumber->floatValuesSlice(slice);
+	SliceWriter<float> outValues = outNumber->writeFloatValuesSlice(slice, inValues.size());
 	
 	for(int i = 0; i < inValues.size(); ++i){
 		outValues[i] = fabs(inValues[i]);
 	}
-	
-	outNumber->setFloatValuesSlice(slice, outValues);
 }
 
 void Abs::updateSlice(Attribute *attribute, unsigned int slice){
@@ -297,8 +295,8 @@ Node(name, parent){
 }
 
 void CrossProduct::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<Imath::V3f> &vectorValues0 = _vector0->value()->vec3ValuesSlice(slice);
-	const std::vector<Imath::V3f> &vectorValues1 = _vector1->value()->vec3ValuesSlice(slice);
+	SliceView<Imath::V3f> vectorValues0 = _vector0->value()->vec3ValuesSlice(slice);
+	SliceView<Imath::V3f> vectorValues1 = _vector1->value()->vec3ValuesSlice(slice);
 	
 	int size0 = vectorValues0.size();
 	int size1 = vectorValues1.size();
@@ -308,13 +306,11 @@ void CrossProduct::updateSlice(Attribute *attribute, unsigned int slice){
 		minSize = size1;
 	}
 	
-	std::vector<Imath::V3f> crossedValues(minSize);
+	SliceWriter<Imath::V3f> crossedValues = _crossProduct->outValue()->writeVec3ValuesSlice(slice, minSize);
 	
 	for(int i = 0; i < minSize; ++i){
 		crossedValues[i] = vectorValues0[i].cross(vectorValues1[i]);
 	}
-	
-	_crossProduct->outValue()->setVec3ValuesSlice(slice, crossedValues);
 }
 
 DotProduct::DotProduct(const std::string &name, Node *parent): 
@@ -365,8 +361,8 @@ void DotProduct::attributeSpecializationChanged(Attribute *attribute){
 }
 
 void DotProduct::updateVec3(Numeric *element0, Numeric *element1, Numeric *dotProduct, unsigned int slice){
-	const std::vector<Imath::V3f> &elementValues0 = element0->vec3ValuesSlice(slice);
-	const std::vector<Imath::V3f> &elementValues1 = element1->vec3ValuesSlice(slice);
+	SliceView<Imath::V3f> elementValues0 = element0->vec3ValuesSlice(slice);
+	SliceView<Imath::V3f> elementValues1 = element1->vec3ValuesSlice(slice);
 
 	int size0 = elementValues0.size();
 	int size1 = elementValues1.size();
@@ -376,18 +372,16 @@ void DotProduct::updateVec3(Numeric *element0, Numeric *element1, Numeric *dotPr
 		minSize = size1;
 	}
 
-	std::vector<float> dotValues(minSize);
+	SliceWriter<float> dotValues = dotProduct->writeFloatValuesSlice(slice, minSize);
 
 	for(int i = 0; i < minSize; ++i){
 		dotValues[i] = elementValues0[i].dot(elementValues1[i]);
 	}
-
-	dotProduct->setFloatValuesSlice(slice, dotValues);
 }
 
 void DotProduct::updateQuat(Numeric *element0, Numeric *element1, Numeric *dotProduct, unsigned int slice){
-	const std::vector<Imath::Quatf> &elementValues0 = element0->quatValuesSlice(slice);
-	const std::vector<Imath::Quatf> &elementValues1 = element1->quatValuesSlice(slice);
+	SliceView<Imath::Quatf> elementValues0 = element0->quatValuesSlice(slice);
+	SliceView<Imath::Quatf> elementValues1 = element1->quatValuesSlice(slice);
 
 	int size0 = elementValues0.size();
 	int size1 = elementValues1.size();
@@ -397,13 +391,11 @@ void DotProduct::updateQuat(Numeric *element0, Numeric *element1, Numeric *dotPr
 		minSize = size1;
 	}
 
-	std::vector<float> dotValues(minSize);
+	SliceWriter<float> dotValues = dotProduct->writeFloatValuesSlice(slice, minSize);
 
 	for(int i = 0; i < minSize; ++i){
 		dotValues[i] = elementValues0[i] ^ elementValues1[i];
 	}
-
-	dotProduct->setFloatValuesSlice(slice, dotValues);
 }
 
 void DotProduct::updateSpecializationLink(Attribute *attributeA, Attribute *attributeB, std::vector<std::string> &specializationA, std::vector<std::string> &specializationB){
@@ -468,27 +460,23 @@ void Normalize::attributeSpecializationChanged(Attribute *attribute){
 }
 
 void Normalize::updateVec3(Numeric *element, Numeric *normalized, unsigned int slice){
-	const std::vector<Imath::V3f> &elementValues = element->vec3ValuesSlice(slice);
+	SliceView<Imath::V3f> elementValues = element->vec3ValuesSlice(slice);
 	int size = elementValues.size();
 	
-	std::vector<Imath::V3f> normalizedValues(size);
+	SliceWriter<Imath::V3f> normalizedValues = normalized->writeVec3ValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
 		normalizedValues[i] = elementValues[i].normalized();
 	}
-	
-	normalized->setVec3ValuesSlice(slice, normalizedValues);
 }
 
 void Normalize::updateQuat(Numeric *element, Numeric *normalized, unsigned int slice){
-	const std::vector<Imath::Quatf> &elementValues = element->quatValuesSlice(slice);
+	SliceView<Imath::Quatf> elementValues = element->quatValuesSlice(slice);
 	int size = elementValues.size();
 	
-	std::vector<Imath::Quatf> normalizedValues(size);
+	SliceWriter<Imath::Quatf> normalizedValues = normalized->writeQuatValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
 		normalizedValues[i] = elementValues[i].normalized();
 	}
-	
-	normalized->setQuatValuesSlice(slice, normalizedValues);
 }
 
 void Normalize::updateSlice(Attribute *attribute, unsigned int slice){
@@ -536,9 +524,9 @@ TrigonometricFunctions::TrigonometricFunctions(const std::string &name, Node *pa
 }
 
 void TrigonometricFunctions::updateSlice(Attribute *attribute, unsigned int slice){
-	std::vector<float> inValues = _inNumber->value()->floatValuesSlice(slice);
+	SliceView<float> inValues = _inNumber->value()->floatValuesSlice(slice);
 	int inFunction = _function->value()->currentIndex();
-	std::vector<float> outValues(inValues.size());
+	SliceWriter<float> outValues = _outNumber->outValue()->writeFloatValuesSlice(slice, inValues.size());
 
 	for(int i = 0; i < inValues.size(); ++i){
 		switch(inFunction)
@@ -572,8 +560,6 @@ void TrigonometricFunctions::updateSlice(Attribute *attribute, unsigned int slic
 			break;
 		}
 	}
-
-	_outNumber->outValue()->setFloatValuesSlice(slice, outValues);
 }
 
 Radians::Radians(const std::string &name, Node *parent): Node(name, parent){
@@ -597,15 +583,20 @@ Radians::Radians(const std::string &name, Node *parent): Node(name, parent){
 }
 
 void Radians::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<float> &in = _inNumber->value()->floatValuesSlice(slice);
+	Numeric *inNumber = _inNumber->value();
+	if(inNumber->isUniformSlice(slice)){
+		float value = inNumber->floatValueAtSlice(slice, 0);
+		_outNumber->outValue()->setFloatUniformSlice(slice, value*M_PI/180.0f, inNumber->sizeSlice(slice));
+		return;
+	}
+	
+	SliceView<float> in = inNumber->floatValuesSlice(slice);
 	int size = in.size();
 
-	std::vector<float> outValues(size);
+	SliceWriter<float> outValues = _outNumber->outValue()->writeFloatValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
 		outValues[i] = in[i]*M_PI/180.0f;
 	}
-
-	_outNumber->outValue()->setFloatValuesSlice(slice, outValues);
 }
 
 Degrees::Degrees(const std::string &name, Node *parent): Node(name, parent){
@@ -629,15 +620,20 @@ Degrees::Degrees(const std::string &name, Node *parent): Node(name, parent){
 }
 
 void Degrees::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<float> &in = _inNumber->value()->floatValuesSlice(slice);
+	Numeric *inNumber = _inNumber->value();
+	if(inNumber->isUniformSlice(slice)){
+		float value = inNumber->floatValueAtSlice(slice, 0);
+		_outNumber->outValue()->setFloatUniformSlice(slice, value*180.0f/float(M_PI), inNumber->sizeSlice(slice));
+		return;
+	}
+	
+	SliceView<float> in = inNumber->floatValuesSlice(slice);
 	int size = in.size();
 
-	std::vector<float> outValues(size);
+	SliceWriter<float> outValues = _outNumber->outValue()->writeFloatValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
 		outValues[i] = in[i]*180.0f/float(M_PI);
 	}
-
-	_outNumber->outValue()->setFloatValuesSlice(slice, outValues);
 }
 
 Floor::Floor(const std::string &name, Node *parent): Node(name, parent){
@@ -661,15 +657,20 @@ Floor::Floor(const std::string &name, Node *parent): Node(name, parent){
 }
 
 void Floor::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<float> &in = _inNumber->value()->floatValuesSlice(slice);
+	Numeric *inNumber = _inNumber->value();
+	if(inNumber->isUniformSlice(slice)){
+		float value = inNumber->floatValueAtSlice(slice, 0);
+		_outNumber->outValue()->setFloatUniformSlice(slice, std::floor(value), inNumber->sizeSlice(slice));
+		return;
+	}
+	
+	SliceView<float> in = inNumber->floatValuesSlice(slice);
 	int size = in.size();
 
-	std::vector<float> outValues(size);
+	SliceWriter<float> outValues = _outNumber->outValue()->writeFloatValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
 		outValues[i] = std::floor(in[i]);
 	}
-
-	_outNumber->outValue()->setFloatValuesSlice(slice, outValues);
 }
 
 Ceil::Ceil(const std::string &name, Node *parent): Node(name, parent){
@@ -693,15 +694,20 @@ Ceil::Ceil(const std::string &name, Node *parent): Node(name, parent){
 }
 
 void Ceil::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<float> &in = _inNumber->value()->floatValuesSlice(slice);
+	Numeric *inNumber = _inNumber->value();
+	if(inNumber->isUniformSlice(slice)){
+		float value = inNumber->floatValueAtSlice(slice, 0);
+		_outNumber->outValue()->setFloatUniformSlice(slice, std::ceil(value), inNumber->sizeSlice(slice));
+		return;
+	}
+	
+	SliceView<float> in = inNumber->floatValuesSlice(slice);
 	int size = in.size();
 
-	std::vector<float> outValues(size);
+	SliceWriter<float> outValues = _outNumber->outValue()->writeFloatValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
 		outValues[i] = std::ceil(in[i]);
 	}
-
-	_outNumber->outValue()->setFloatValuesSlice(slice, outValues);
 }
 
 Round::Round(const std::string &name, Node *parent): Node(name, parent){
@@ -725,15 +731,20 @@ Round::Round(const std::string &name, Node *parent): Node(name, parent){
 }
 
 void Round::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<float> &in = _inNumber->value()->floatValuesSlice(slice);
+	Numeric *inNumber = _inNumber->value();
+	if(inNumber->isUniformSlice(slice)){
+		float value = inNumber->floatValueAtSlice(slice, 0);
+		_outNumber->outValue()->setFloatUniformSlice(slice, std::floor(value+0.5), inNumber->sizeSlice(slice));
+		return;
+	}
+	
+	SliceView<float> in = inNumber->floatValuesSlice(slice);
 	int size = in.size();
 
-	std::vector<float> outValues(size);
+	SliceWriter<float> outValues = _outNumber->outValue()->writeFloatValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
 		outValues[i] = std::floor(in[i]+0.5);
 	}
-
-	_outNumber->outValue()->setFloatValuesSlice(slice, outValues);
 }
 
 Exp::Exp(const std::string &name, Node *parent): Node(name, parent){
@@ -757,15 +768,20 @@ Exp::Exp(const std::string &name, Node *parent): Node(name, parent){
 }
 
 void Exp::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<float> &in = _inNumber->value()->floatValuesSlice(slice);
+	Numeric *inNumber = _inNumber->value();
+	if(inNumber->isUniformSlice(slice)){
+		float value = inNumber->floatValueAtSlice(slice, 0);
+		_outNumber->outValue()->setFloatUniformSlice(slice, std::exp(value), inNumber->sizeSlice(slice));
+		return;
+	}
+	
+	SliceView<float> in = inNumber->floatValuesSlice(slice);
 	int size = in.size();
 
-	std::vector<float> outValues(size);
+	SliceWriter<float> outValues = _outNumber->outValue()->writeFloatValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
 		outValues[i] = std::exp(in[i]);
 	}
-
-	_outNumber->outValue()->setFloatValuesSlice(slice, outValues);
 }
 
 Log::Log(const std::string &name, Node *parent): Node(name, parent){
@@ -789,15 +805,20 @@ Log::Log(const std::string &name, Node *parent): Node(name, parent){
 }
 
 void Log::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<float> &in = _inNumber->value()->floatValuesSlice(slice);
+	Numeric *inNumber = _inNumber->value();
+	if(inNumber->isUniformSlice(slice)){
+		float value = inNumber->floatValueAtSlice(slice, 0);
+		_outNumber->outValue()->setFloatUniformSlice(slice, std::log(value), inNumber->sizeSlice(slice));
+		return;
+	}
+	
+	SliceView<float> in = inNumber->floatValuesSlice(slice);
 	int size = in.size();
 
-	std::vector<float> outValues(size);
+	SliceWriter<float> outValues = _outNumber->outValue()->writeFloatValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
 		outValues[i] = std::log(in[i]);
 	}
-
-	_outNumber->outValue()->setFloatValuesSlice(slice, outValues);
 }
 
 Pow::Pow(const std::string &name, Node *parent): Node(name, parent){
@@ -826,16 +847,14 @@ Pow::Pow(const std::string &name, Node *parent): Node(name, parent){
 }
 
 void Pow::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<float> &base = _base->value()->floatValuesSlice(slice);
-	const std::vector<float> &exponent = _exponent->value()->floatValuesSlice(slice);
+	SliceView<float> base = _base->value()->floatValuesSlice(slice);
+	SliceView<float> exponent = _exponent->value()->floatValuesSlice(slice);
 	int size = base.size();
 
-	std::vector<float> outValues(size);
+	SliceWriter<float> outValues = _outNumber->outValue()->writeFloatValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
 		outValues[i] = std::pow(base[i],exponent[i]);
 	}
-
-	_outNumber->outValue()->setFloatValuesSlice(slice, outValues);
 }
 
 Sqrt::Sqrt(const std::string &name, Node *parent): Node(name, parent){
@@ -859,15 +878,20 @@ Sqrt::Sqrt(const std::string &name, Node *parent): Node(name, parent){
 }
 
 void Sqrt::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<float> &in = _inNumber->value()->floatValuesSlice(slice);
+	Numeric *inNumber = _inNumber->value();
+	if(inNumber->isUniformSlice(slice)){
+		float value = inNumber->floatValueAtSlice(slice, 0);
+		_outNumber->outValue()->setFloatUniformSlice(slice, std::sqrt(value), inNumber->sizeSlice(slice));
+		return;
+	}
+	
+	SliceView<float> in = inNumber->floatValuesSlice(slice);
 	int size = in.size();
 
-	std::vector<float> outValues(size);
+	SliceWriter<float> outValues = _outNumber->outValue()->writeFloatValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
 		outValues[i] = std::sqrt(in[i]);
 	}
-
-	_outNumber->outValue()->setFloatValuesSlice(slice, outValues);
 }
 
 Atan2::Atan2(const std::string &name, Node *parent): Node(name, parent){
@@ -896,16 +920,14 @@ Atan2::Atan2(const std::string &name, Node *parent): Node(name, parent){
 }
 
 void Atan2::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<float> &y = _inNumberY->value()->floatValuesSlice(slice);
-	const std::vector<float> &x = _inNumberX->value()->floatValuesSlice(slice);
+	SliceView<float> y = _inNumberY->value()->floatValuesSlice(slice);
+	SliceView<float> x = _inNumberX->value()->floatValuesSlice(slice);
 	int size = y.size();
 
-	std::vector<float> outValues(size);
+	SliceWriter<float> outValues = _outNumber->outValue()->writeFloatValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
 		outValues[i] = std::atan2(y[i],x[i]);
 	}
-
-	_outNumber->outValue()->setFloatValuesSlice(slice, outValues);
 }
 
 Min::Min(const std::string &name, Node *parent):
@@ -949,29 +971,45 @@ void Min::attributeSpecializationChanged(Attribute *attribute){
 }
 
 void Min::min_int(Numeric *inNumber, Numeric *outNumber, unsigned int slice){
-	std::vector<int> inValues = inNumber->intValuesSlice(slice);
-	std::vector<int> outValues(1);
+	SliceWriter<int> outValues = outNumber->writeIntValuesSlice(slice, 1);
 
 	int min = std::numeric_limits<int>::max();
-	for(int i = 0; i < inValues.size(); ++i){
-		min = (inValues[i]<min?inValues[i]:min);
+
+	// the smallest value of a constant or range array is one of its ends, there's no need to expand it
+	if(inNumber->isUniformSlice(slice) || inNumber->isRangeSlice(slice)){
+		int first = inNumber->intValueAtSlice(slice, 0);
+		int last = inNumber->intValueAtSlice(slice, inNumber->sizeSlice(slice) - 1);
+		min = (first<min?first:min);
+		min = (last<min?last:min);
+	}
+	else{
+		SliceView<int> inValues = inNumber->intValuesSlice(slice);
+		for(int i = 0; i < inValues.size(); ++i){
+			min = (inValues[i]<min?inValues[i]:min);
+		}
 	}
 	outValues[0] = min;
-
-	outNumber->setIntValuesSlice(slice, outValues);
 }
 
 void Min::min_float(Numeric *inNumber, Numeric *outNumber, unsigned int slice){
-	std::vector<float> inValues = inNumber->floatValuesSlice(slice);
-	std::vector<float> outValue(1);
+	SliceWriter<float> outValue = outNumber->writeFloatValuesSlice(slice, 1);
 
 	float min = std::numeric_limits<float>::max();
-	for(int i = 0; i < inValues.size(); ++i){
-		min = (inValues[i]<min?inValues[i]:min);
+
+	// the smallest value of a constant or range array is one of its ends, there's no need to expand it
+	if(inNumber->isUniformSlice(slice) || inNumber->isRangeSlice(slice)){
+		float first = inNumber->floatValueAtSlice(slice, 0);
+		float last = inNumber->floatValueAtSlice(slice, inNumber->sizeSlice(slice) - 1);
+		min = (first<min?first:min);
+		min = (last<min?last:min);
+	}
+	else{
+		SliceView<float> inValues = inNumber->floatValuesSlice(slice);
+		for(int i = 0; i < inValues.size(); ++i){
+			min = (inValues[i]<min?inValues[i]:min);
+		}
 	}
 	outValue[0] = min;
-
-	outNumber->setFloatValuesSlice(slice, outValue);
 }
 
 void Min::updateSlice(Attribute *attribute, unsigned int slice){
@@ -1049,29 +1087,45 @@ void Max::attributeSpecializationChanged(Attribute *attribute){
 }
 
 void Max::max_int(Numeric *inNumber, Numeric *outNumber, unsigned int slice){
-	std::vector<int> inValues = inNumber->intValuesSlice(slice);
-	std::vector<int> outValues(1);
+	SliceWriter<int> outValues = outNumber->writeIntValuesSlice(slice, 1);
 
 	int max = std::numeric_limits<int>::min();
-	for(int i = 0; i < inValues.size(); ++i){
-		max = (inValues[i]>max?inValues[i]:max);
+
+	// the largest value of a constant or range array is one of its ends, there's no need to expand it
+	if(inNumber->isUniformSlice(slice) || inNumber->isRangeSlice(slice)){
+		int first = inNumber->intValueAtSlice(slice, 0);
+		int last = inNumber->intValueAtSlice(slice, inNumber->sizeSlice(slice) - 1);
+		max = (first>max?first:max);
+		max = (last>max?last:max);
+	}
+	else{
+		SliceView<int> inValues = inNumber->intValuesSlice(slice);
+		for(int i = 0; i < inValues.size(); ++i){
+			max = (inValues[i]>max?inValues[i]:max);
+		}
 	}
 	outValues[0] = max;
-
-	outNumber->setIntValuesSlice(slice, outValues);
 }
 
 void Max::max_float(Numeric *inNumber, Numeric *outNumber, unsigned int slice){
-	std::vector<float> inValues = inNumber->floatValuesSlice(slice);
-	std::vector<float> outValue(1);
+	SliceWriter<float> outValue = outNumber->writeFloatValuesSlice(slice, 1);
 
 	float max = std::numeric_limits<float>::min();
-	for(int i = 0; i < inValues.size(); ++i){
-		max = (inValues[i]>max?inValues[i]:max);
+
+	// the largest value of a constant or range array is one of its ends, there's no need to expand it
+	if(inNumber->isUniformSlice(slice) || inNumber->isRangeSlice(slice)){
+		float first = inNumber->floatValueAtSlice(slice, 0);
+		float last = inNumber->floatValueAtSlice(slice, inNumber->sizeSlice(slice) - 1);
+		max = (first>max?first:max);
+		max = (last>max?last:max);
+	}
+	else{
+		SliceView<float> inValues = inNumber->floatValuesSlice(slice);
+		for(int i = 0; i < inValues.size(); ++i){
+			max = (inValues[i]>max?inValues[i]:max);
+		}
 	}
 	outValue[0] = max;
-
-	outNumber->setFloatValuesSlice(slice, outValue);
 }
 
 void Max::updateSlice(Attribute *attribute, unsigned int slice){
@@ -1154,42 +1208,51 @@ void Average::attributeSpecializationChanged(Attribute *attribute){
 }
 
 void Average::average_int(Numeric *inNumber, Numeric *outNumber, unsigned int slice){
-	std::vector<int> inValues = inNumber->intValuesSlice(slice);
-	std::vector<int> outValues(1);
+	SliceWriter<int> outValues = outNumber->writeIntValuesSlice(slice, 1);
+	if(inNumber->isUniformSlice(slice)){
+		outValues[0] = inNumber->intValueAtSlice(slice, 0);
+		return;
+	}
+	
+	SliceView<int> inValues = inNumber->intValuesSlice(slice);
 
 	int av = 0;
 	for(int i = 0; i < inValues.size(); ++i){
 		av += inValues[i];
 	}
 	outValues[0] = int(av/inValues.size());
-
-	outNumber->setIntValuesSlice(slice, outValues);
 }
 
 void Average::average_float(Numeric *inNumber, Numeric *outNumber, unsigned int slice){
-	std::vector<float> inValues = inNumber->floatValuesSlice(slice);
-	std::vector<float> outValue(1);
+	SliceWriter<float> outValue = outNumber->writeFloatValuesSlice(slice, 1);
+	if(inNumber->isUniformSlice(slice)){
+		outValue[0] = inNumber->floatValueAtSlice(slice, 0);
+		return;
+	}
+	
+	SliceView<float> inValues = inNumber->floatValuesSlice(slice);
 
 	float av = 0;
 	for(int i = 0; i < inValues.size(); ++i){
 		av += inValues[i];
 	}
 	outValue[0] = av/inValues.size();
-
-	outNumber->setFloatValuesSlice(slice, outValue);
 }
 
 void Average::average_vec3(Numeric *inNumber, Numeric *outNumber, unsigned int slice){
-	std::vector<Imath::V3f> inValues = inNumber->vec3ValuesSlice(slice);
-	std::vector<Imath::V3f> outValue(1);
+	SliceWriter<Imath::V3f> outValue = outNumber->writeVec3ValuesSlice(slice, 1);
+	if(inNumber->isUniformSlice(slice)){
+		outValue[0] = inNumber->vec3ValueAtSlice(slice, 0);
+		return;
+	}
+	
+	SliceView<Imath::V3f> inValues = inNumber->vec3ValuesSlice(slice);
 
 	Imath::V3f av(0.0,0.0,0.0);
 	for(int i = 0; i < inValues.size(); ++i){
 		av += inValues[i];
 	}
 	outValue[0] = av/float(inValues.size());
-
-	outNumber->setVec3ValuesSlice(slice, outValue);
 }
 
 void Average::updateSlice(Attribute *attribute, unsigned int slice){
@@ -1346,9 +1409,9 @@ void Slerp::updateSpecializationLink(Attribute *attributeA, Attribute *attribute
 }
 
 void Slerp::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<Imath::Quatf> &q1 = _inQuat1->value()->quatValuesSlice(slice);
-	const std::vector<Imath::Quatf> &q2 = _inQuat2->value()->quatValuesSlice(slice);
-	const std::vector<float> &t = _param->value()->floatValuesSlice(slice);
+	SliceView<Imath::Quatf> q1 = _inQuat1->value()->quatValuesSlice(slice);
+	SliceView<Imath::Quatf> q2 = _inQuat2->value()->quatValuesSlice(slice);
+	SliceView<float> t = _param->value()->floatValuesSlice(slice);
 	int size = q1.size();
 	size = (q2.size()<size)?q2.size():size;
 	size = (t.size()<size)?t.size():size;
@@ -1387,8 +1450,8 @@ QuatMultiply::QuatMultiply(const std::string &name, Node *parent): Node(name, pa
 }
 
 void QuatMultiply::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<Imath::Quatf> &q0 = _quat0->value()->quatValuesSlice(slice);
-	const std::vector<Imath::Quatf> &q1 = _quat1->value()->quatValuesSlice(slice);
+	SliceView<Imath::Quatf> q0 = _quat0->value()->quatValuesSlice(slice);
+	SliceView<Imath::Quatf> q1 = _quat1->value()->quatValuesSlice(slice);
 
 	int size0 = q0.size();
 	int size1 = q1.size();
@@ -1446,27 +1509,23 @@ void Negate::attributeSpecializationChanged(Attribute *attribute){
 }
 
 void Negate::updateVec3(Numeric *element, Numeric *negated, unsigned int slice){
-	std::vector<Imath::V3f> elementValues = element->vec3ValuesSlice(slice);
+	SliceView<Imath::V3f> elementValues = element->vec3ValuesSlice(slice);
 
 	unsigned int size = elementValues.size();
-	std::vector<Imath::V3f> negatedValues(size);
+	SliceWriter<Imath::V3f> negatedValues = negated->writeVec3ValuesSlice(slice, size);
 	for(int i = 0; i < size ;++i){
-		negatedValues[i] = elementValues[i].negate();
+		negatedValues[i] = -elementValues[i];
 	}
-	
-	negated->setVec3ValuesSlice(slice, negatedValues);
 }
 
 void Negate::updateMatrix44(Numeric *element, Numeric *negated, unsigned int slice){
-	std::vector<Imath::M44f> elementValues = element->matrix44ValuesSlice(slice);
+	SliceView<Imath::M44f> elementValues = element->matrix44ValuesSlice(slice);
 
 	unsigned int size = elementValues.size();
-	std::vector<Imath::M44f> negatedValues(size);
+	SliceWriter<Imath::M44f> negatedValues = negated->writeMatrix44ValuesSlice(slice, size);
 	for(int i = 0; i < size ;++i){
-		negatedValues[i] = elementValues[i].negate();
+		negatedValues[i] = -elementValues[i];
 	}
-	
-	negated->setMatrix44ValuesSlice(slice, negatedValues);
 }
 
 void Negate::updateSlice(Attribute *attribute, unsigned int slice){
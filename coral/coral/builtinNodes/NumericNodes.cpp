@@ -28,6 +28,7 @@
 
 #include <map>
 #include <cmath>
+#include <algorithm>
 
 #ifdef CORAL_PARALLEL_TBB
 	#include <tbb/mutex.h>
@@ -39,6 +40,7 @@
 #include "../src/mathUtils.h"
 #include "../src/stringUtils.h"
 #include "../src/Command.h"
+#include "../src/NetworkManager.h"
 
 #include <ImathEuler.h>
 
@@ -183,7 +185,7 @@ void Vec3Node::updateSlice(Attribute *attribute, unsigned int slice){
 	if(minorSize < 1)
 		minorSize = 1;
 	
-	std::vector<Imath::V3f> outArray(minorSize);
+	SliceWriter<Imath::V3f> outArray = _vector->outValue()->writeVec3ValuesSlice(slice, minorSize);
 
 	for(int i = 0; i < minorSize; ++i){
 		Imath::V3f *vec = &outArray[i];
@@ -191,12 +193,11 @@ void Vec3Node::updateSlice(Attribute *attribute, unsigned int slice){
 		vec->y = y->floatValueAtSlice(slice, i);
 		vec->z = z->floatValueAtSlice(slice, i);
 	}
-	
-	_vector->outValue()->setVec3ValuesSlice(slice, outArray);
 }
 
 Vec3ToFloats::Vec3ToFloats(const std::string &name, Node* parent): Node(name, parent){
 	setSliceable(true);
+	setUpdateOutputsTogether(true);
 
 	_vector = new NumericAttribute("vector", this);
 	_x = new NumericAttribute("x", this);
@@ -256,28 +257,21 @@ void Vec3ToFloats::updateSpecializationLink(Attribute *attributeA, Attribute *at
 	}
 }
 
-void Vec3ToFloats::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<Imath::V3f> &vec3Values = _vector->value()->vec3ValuesSlice(slice);
+void Vec3ToFloats::updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice){
+	SliceView<Imath::V3f> vec3Values = _vector->value()->vec3ValuesSlice(slice);
 	int size = vec3Values.size();
 	
-	std::vector<float> xValues(size);
-	std::vector<float> yValues(size);
-	std::vector<float> zValues(size);
-	
-	for(int i = 0; i < size; ++i){
-		const Imath::V3f &vec = vec3Values[i];
-		xValues[i] = vec.x;
-		yValues[i] = vec.y;
-		zValues[i] = vec.z;
+	for(int i = 0; i < outputs.size(); ++i){
+		NumericAttribute *output = (NumericAttribute*)outputs[i];
+		int component = output == _x ? 0 : (output == _y ? 1 : 2);
+		
+		std::vector<float> values(size);
+		for(int j = 0; j < size; ++j){
+			values[j] = vec3Values[j][component];
+		}
+		
+		output->outValue()->setFloatValuesSlice(slice, values);
 	}
-	
-	_x->outValue()->setFloatValuesSlice(slice, xValues);
-	_y->outValue()->setFloatValuesSlice(slice, yValues);
-	_z->outValue()->setFloatValuesSlice(slice, zValues);
-	
-	setAttributeIsClean(_x, true);
-	setAttributeIsClean(_y, true);
-	setAttributeIsClean(_z, true);
 }
 
 Col4Node::Col4Node(const std::string &name, Node* parent): Node(name, parent){
@@ -379,7 +373,7 @@ void Col4Node::updateSlice(Attribute *attribute, unsigned int slice){
 	if(minorSize < 1)
 		minorSize = 1;
 
-	std::vector<Imath::Color4f> outArray(minorSize);
+	SliceWriter<Imath::Color4f> outArray = _color->outValue()->writeCol4ValuesSlice(slice, minorSize);
 
 	for(int i = 0; i < minorSize; ++i){
 		Imath::Color4f *col = &outArray[i];
@@ -388,12 +382,11 @@ void Col4Node::updateSlice(Attribute *attribute, unsigned int slice){
 		col->b = b->floatValueAtSlice(slice, i);
 		col->a = a->floatValueAtSlice(slice, i);
 	}
-
-	_color->outValue()->setCol4ValuesSlice(slice, outArray);
 }
 
 Col4ToFloats::Col4ToFloats(const std::string &name, Node* parent): Node(name, parent){
 	setSliceable(true);
+	setUpdateOutputsTogether(true);
 
 	_color = new NumericAttribute("color", this);
 	_r = new NumericAttribute("r", this);
@@ -463,32 +456,21 @@ void Col4ToFloats::updateSpecializationLink(Attribute *attributeA, Attribute *at
 	}
 }
 
-void Col4ToFloats::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<Imath::Color4f> &col4Values = _color->value()->col4ValuesSlice(slice);
+void Col4ToFloats::updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice){
+	SliceView<Imath::Color4f> col4Values = _color->value()->col4ValuesSlice(slice);
 	int size = col4Values.size();
 
-	std::vector<float> rValues(size);
-	std::vector<float> gValues(size);
-	std::vector<float> bValues(size);
-	std::vector<float> aValues(size);
-
-	for(int i = 0; i < size; ++i){
-		const Imath::Color4f &col = col4Values[i];
-		rValues[i] = col.r;
-		gValues[i] = col.g;
-		bValues[i] = col.b;
-		aValues[i] = col.a;
+	for(int i = 0; i < outputs.size(); ++i){
+		NumericAttribute *output = (NumericAttribute*)outputs[i];
+		int component = output == _r ? 0 : (output == _g ? 1 : (output == _b ? 2 : 3));
+		
+		std::vector<float> values(size);
+		for(int j = 0; j < size; ++j){
+			values[j] = col4Values[j][component];
+		}
+		
+		output->outValue()->setFloatValuesSlice(slice, values);
 	}
-
-	_r->outValue()->setFloatValuesSlice(slice, rValues);
-	_g->outValue()->setFloatValuesSlice(slice, gValues);
-	_b->outValue()->setFloatValuesSlice(slice, bValues);
-	_a->outValue()->setFloatValuesSlice(slice, aValues);
-
-	setAttributeIsClean(_r, true);
-	setAttributeIsClean(_g, true);
-	setAttributeIsClean(_b, true);
-	setAttributeIsClean(_a, true);
 }
 
 Col4Reverse::Col4Reverse(const std::string &name, Node* parent): Node(name, parent){
@@ -544,10 +526,10 @@ void Col4Reverse::updateSpecializationLink(Attribute *attributeA, Attribute *att
 }
 
 void Col4Reverse::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<Imath::Color4f> &inCol4Values = _inColor->value()->col4ValuesSlice(slice);
+	SliceView<Imath::Color4f> inCol4Values = _inColor->value()->col4ValuesSlice(slice);
 	int size = inCol4Values.size();
 
-	std::vector<Imath::Color4f> outCol4Values(size);
+	SliceWriter<Imath::Color4f> outCol4Values = _outColor->outValue()->writeCol4ValuesSlice(slice, size);
 
 	for(int i = 0; i < size; ++i){
 		const Imath::Color4f &inCol4 = inCol4Values[i];
@@ -558,8 +540,6 @@ void Col4Reverse::updateSlice(Attribute *attribute, unsigned int slice){
 		outCol4Values[i].a = inCol4.a;
 	}
 
-	_outColor->outValue()->setCol4ValuesSlice(slice, outCol4Values);
-
 	setAttributeIsClean(_outColor, true);
 }
 
@@ -646,7 +626,7 @@ void QuatNode::updateSlice(Attribute *attribute, unsigned int slice){
 	if(minorSize < 1)
 		minorSize = 1;
 
-	std::vector<Imath::Quatf> outArray(minorSize);
+	SliceWriter<Imath::Quatf> outArray = _quat->outValue()->writeQuatValuesSlice(slice, minorSize);
 
 	for(int i = 0; i < minorSize; ++i){
 		Imath::Quatf *vec = &outArray[i];
@@ -655,12 +635,11 @@ void QuatNode::updateSlice(Attribute *attribute, unsigned int slice){
 		vec->v.y = y->floatValueAtSlice(slice, i);
 		vec->v.z = z->floatValueAtSlice(slice, i);
 	}
-
-	_quat->outValue()->setQuatValuesSlice(slice, outArray);
 }
 
 QuatToFloats::QuatToFloats(const std::string &name, Node* parent): Node(name, parent){
 	setSliceable(true);
+	setUpdateOutputsTogether(true);
 
 	_quat = new NumericAttribute("quaternion", this);
 	_r = new NumericAttribute("r", this);
@@ -732,32 +711,28 @@ void QuatToFloats::updateSpecializationLink(Attribute *attributeA, Attribute *at
 	}
 }
 
-void QuatToFloats::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<Imath::Quatf> &quatValues = _quat->value()->quatValuesSlice(slice);
+void QuatToFloats::updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice){
+	SliceView<Imath::Quatf> quatValues = _quat->value()->quatValuesSlice(slice);
 	int size = quatValues.size();
 
-	std::vector<float> rValues(size);
-	std::vector<float> xValues(size);
-	std::vector<float> yValues(size);
-	std::vector<float> zValues(size);
-
-	for(int i = 0; i < size; ++i){
-		const Imath::Quatf &vec = quatValues[i];
-		rValues[i] = vec.r;
-		xValues[i] = vec.v.x;
-		yValues[i] = vec.v.y;
-		zValues[i] = vec.v.z;
+	for(int i = 0; i < outputs.size(); ++i){
+		NumericAttribute *output = (NumericAttribute*)outputs[i];
+		
+		std::vector<float> values(size);
+		if(output == _r){
+			for(int j = 0; j < size; ++j){
+				values[j] = quatValues[j].r;
+			}
+		}
+		else{
+			int component = output == _x ? 0 : (output == _y ? 1 : 2);
+			for(int j = 0; j < size; ++j){
+				values[j] = quatValues[j].v[component];
+			}
+		}
+		
+		output->outValue()->setFloatValuesSlice(slice, values);
 	}
-
-	_r->outValue()->setFloatValuesSlice(slice, rValues);
-	_x->outValue()->setFloatValuesSlice(slice, xValues);
-	_y->outValue()->setFloatValuesSlice(slice, yValues);
-	_z->outValue()->setFloatValuesSlice(slice, zValues);
-
-	setAttributeIsClean(_r, true);
-	setAttributeIsClean(_x, true);
-	setAttributeIsClean(_y, true);
-	setAttributeIsClean(_z, true);
 }
 
 
@@ -903,7 +878,7 @@ void Matrix44Node::updateSlice(Attribute *attribute, unsigned int slice){
 	if(minorSize < 1)
 		minorSize = 1;
 	
-	std::vector<Imath::M44f> newMatrixValues(minorSize);
+	SliceWriter<Imath::M44f> newMatrixValues = _matrix->outValue()->writeMatrix44ValuesSlice(slice, minorSize);
 	float radian = (M_PI / 180);
 	for(int i = 0; i < minorSize; ++i){
 		Imath::M44f matrix;
@@ -918,8 +893,6 @@ void Matrix44Node::updateSlice(Attribute *attribute, unsigned int slice){
 		
 		newMatrixValues[i] = matrix;
 	}
-	
-	_matrix->outValue()->setMatrix44ValuesSlice(slice, newMatrixValues);
 }
 
 ConstantArray::ConstantArray(const std::string &name, Node *parent): Node(name, parent){
@@ -989,44 +962,19 @@ void ConstantArray::updateSlice(Attribute *attribute, unsigned int slice){
 		
 		Numeric *array = _array->outValue();
 		if(constant->type() == Numeric::numericTypeInt){
-			int constantValue = constant->intValueAtSlice(slice, 0);
-			std::vector<int> values(size);
-			for(int i = 0; i < size; ++i){
-				values[i] = constantValue;
-			}
-			array->setIntValuesSlice(slice, values);
+			array->setIntUniformSlice(slice, constant->intValueAtSlice(slice, 0), size);
 		}
 		else if(constant->type() == Numeric::numericTypeFloat){
-			float constantValue = constant->floatValueAtSlice(slice, 0);
-			std::vector<float> values(size);
-			for(int i = 0; i < size; ++i){
-				values[i] = constantValue;
-			}
-			array->setFloatValuesSlice(slice, values);
+			array->setFloatUniformSlice(slice, constant->floatValueAtSlice(slice, 0), size);
 		}
 		else if(constant->type() == Numeric::numericTypeVec3){
-			Imath::V3f constantValue = constant->vec3ValueAtSlice(slice, 0);
-			std::vector<Imath::V3f> values(size);
-			for(int i = 0; i < size; ++i){
-				values[i] = constantValue;
-			}
-			array->setVec3ValuesSlice(slice, values);
+			array->setVec3UniformSlice(slice, constant->vec3ValueAtSlice(slice, 0), size);
 		}
 		else if(constant->type() == Numeric::numericTypeCol4){
-			Imath::Color4f constantValue = constant->col4ValueAtSlice(slice, 0);
-			std::vector<Imath::Color4f> values(size);
-			for(int i = 0; i < size; ++i){
-				values[i] = constantValue;
-			}
-			array->setCol4ValuesSlice(slice, values);
+			array->setCol4UniformSlice(slice, constant->col4ValueAtSlice(slice, 0), size);
 		}
 		else if(constant->type() == Numeric::numericTypeMatrix44){
-			Imath::M44f constantValue = constant->matrix44ValueAtSlice(slice, 0);
-			std::vector<Imath::M44f> values(size);
-			for(int i = 0; i < size; ++i){
-				values[i] = constantValue;
-			}
-			array->setMatrix44ValuesSlice(slice, values);
+			array->setMatrix44UniformSlice(slice, constant->matrix44ValueAtSlice(slice, 0), size);
 		}
 	}
 	else{
@@ -1034,6 +982,39 @@ void ConstantArray::updateSlice(Attribute *attribute, unsigned int slice){
 	}
 }
 
+MappedArray::MappedArray(const std::string &name, Node *parent): Node(name, parent){
+	_fileName = new StringAttribute("fileName", this);
+	_array = new NumericAttribute("array", this);
+	
+	addInputAttribute(_fileName);
+	addOutputAttribute(_array);
+	
+	setAttributeAffect(_fileName, _array);
+	
+	std::vector<std::string> arraySpecializations;
+	arraySpecializations.push_back("IntArray");
+	arraySpecializations.push_back("FloatArray");
+	arraySpecializations.push_back("Vec3Array");
+	arraySpecializations.push_back("Col4Array");
+	arraySpecializations.push_back("QuatArray");
+	arraySpecializations.push_back("Matrix44Array");
+	
+	setAttributeAllowedSpecializations(_array, arraySpecializations);
+}
+
+void MappedArray::updateSlice(Attribute *attribute, unsigned int slice){
+	Numeric *array = _array->outValue();
+	if(array->type() == Numeric::numericTypeAny){
+		setAttributeIsClean(_array, false);
+		return;
+	}
+	
+	std::string filename = NetworkManager::resolveFilename(_fileName->value()->stringValue());
+	if(!array->mapValuesSlice(slice, filename)){
+		array->resizeSlice(slice, 0);
+	}
+}
+
 ArraySize::ArraySize(const std::string &name, Node *parent): Node(name, parent){
 	setSliceable(true);
 
@@ -1140,53 +1121,43 @@ void BuildArray::attributeSpecializationChanged(Attribute *attribute){
 }
 
 void BuildArray::updateInt(const std::vector<Attribute*> &inAttrs, int arraySize, Numeric *array, unsigned int slice){
-	std::vector<int> arrayValues(arraySize);
+	SliceWriter<int> arrayValues = array->writeIntValuesSlice(slice, arraySize);
 	for(int i = 0; i < arraySize; ++i){
 		Numeric *inNum = (Numeric*)inAttrs[i]->value();
 		arrayValues[i] = inNum->intValueAtSlice(slice, 0);
 	}
-	
-	array->setIntValuesSlice(slice, arrayValues);
 }
 
 void BuildArray::updateFloat(const std::vector<Attribute*> &inAttrs, int arraySize, Numeric *array, unsigned int slice){
-	std::vector<float> arrayValues(arraySize);
+	SliceWriter<float> arrayValues = array->writeFloatValuesSlice(slice, arraySize);
 	for(int i = 0; i < arraySize; ++i){
 		Numeric *inNum = (Numeric*)inAttrs[i]->value();
 		arrayValues[i] = inNum->floatValueAtSlice(slice, 0);
 	}
-	
-	array->setFloatValuesSlice(slice, arrayValues);
 }
 
 void BuildArray::updateVec3(const std::vector<Attribute*> &inAttrs, int arraySize, Numeric *array, unsigned int slice){
-	std::vector<Imath::V3f> arrayValues(arraySize);
+	SliceWriter<Imath::V3f> arrayValues = array->writeVec3ValuesSlice(slice, arraySize);
 	for(int i = 0; i < arraySize; ++i){
 		Numeric *inNum = (Numeric*)inAttrs[i]->value();
 		arrayValues[i] = inNum->vec3ValueAtSlice(slice, 0);
 	}
-	
-	array->setVec3ValuesSlice(slice, arrayValues);
 }
 
 void BuildArray::updateCol4(const std::vector<Attribute*> &inAttrs, int arraySize, Numeric *array, unsigned int slice){
-	std::vector<Imath::Color4f> arrayValues(arraySize);
+	SliceWriter<Imath::Color4f> arrayValues = array->writeCol4ValuesSlice(slice, arraySize);
 	for(int i = 0; i < arraySize; ++i){
 		Numeric *inNum = (Numeric*)inAttrs[i]->value();
 		arrayValues[i] = inNum->col4ValueAtSlice(slice, 0);
 	}
-
-	array->setCol4ValuesSlice(slice, arrayValues);
 }
 
 void BuildArray::updateMatrix44(const std::vector<Attribute*> &inAttrs, int arraySize, Numeric *array, unsigned int slice){
-	std::vector<Imath::M44f> arrayValues(arraySize);
+	SliceWriter<Imath::M44f> arrayValues = array->writeMatrix44ValuesSlice(slice, arraySize);
 	for(int i = 0; i < arraySize; ++i){
 		Numeric *inNum = (Numeric*)inAttrs[i]->value();
 		arrayValues[i] = inNum->matrix44ValueAtSlice(slice, 0);
 	}
-	
-	array->setMatrix44ValuesSlice(slice, arrayValues);
 }
 
 void BuildArray::updateSlice(Attribute *attribute, unsigned int slice){
@@ -1273,15 +1244,8 @@ void RangeArray::updateInt(Numeric *start, Numeric *end, int steps, Numeric *arr
 	
 	float totalRange = endValue - startValue;
 	int incrStep = totalRange / steps;
-	int currentStep = startValue;
-	std::vector<int> arrayValues(steps + 1);
-	
-	for(int i = 0; i < steps + 1; ++i){
-		arrayValues[i] = currentStep;
-		currentStep += incrStep;
-	}
 	
-	array->setIntValuesSlice(slice, arrayValues);
+	array->setIntRangeSlice(slice, startValue, incrStep, steps + 1);
 }
 
 void RangeArray::updateFloat(Numeric *start, Numeric *end, int steps, Numeric *array, unsigned int slice){
@@ -1290,16 +1254,8 @@ void RangeArray::updateFloat(Numeric *start, Numeric *end, int steps, Numeric *a
 	
 	float totalRange = endValue - startValue;
 	float incrStep = totalRange / float(steps);
-	float currentStep = startValue;
-	std::vector<float> arrayValues(steps + 1);
 	
-	for(int i = 0; i < steps + 1; ++i){
-		arrayValues[i] = currentStep;
-		
-		currentStep += incrStep;
-	}
-	
-	array->setFloatValuesSlice(slice, arrayValues);
+	array->setFloatRangeSlice(slice, startValue, incrStep, steps + 1);
 }
 
 void RangeArray::updateSlice(Attribute *attribute, unsigned int slice){
@@ -1356,9 +1312,9 @@ void Matrix44Translation::updateSpecializationLink(Attribute *attributeA, Attrib
 }
 
 void Matrix44Translation::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<Imath::M44f> &matrix = _matrix->value()->matrix44ValuesSlice(slice);
+	SliceView<Imath::M44f> matrix = _matrix->value()->matrix44ValuesSlice(slice);
 	int size = matrix.size();
-	std::vector<Imath::V3f> translationValues(size);
+	SliceWriter<Imath::V3f> translationValues = _translation->outValue()->writeVec3ValuesSlice(slice, size);
 	
 	for(int i = 0; i < size; ++i){
 		Imath::V3f &translationValue = translationValues[i];
@@ -1368,12 +1324,11 @@ void Matrix44Translation::updateSlice(Attribute *attribute, unsigned int slice){
 		translationValue.y = m[3][1];
 		translationValue.z = m[3][2];
 	}
-	
-	_translation->outValue()->setVec3ValuesSlice(slice, translationValues);
 }
 
 Matrix44RotationAxis::Matrix44RotationAxis(const std::string &name, Node* parent): Node(name, parent){	
 	setSliceable(true);
+	setUpdateOutputsTogether(true);
 
 	_matrix = new NumericAttribute("matrix", this);
 	_axisX = new NumericAttribute("axisX", this);
@@ -1419,27 +1374,22 @@ void Matrix44RotationAxis::updateSpecializationLink(Attribute *attributeA, Attri
 	}
 }
 
-void Matrix44RotationAxis::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<Imath::M44f> &matrix = _matrix->value()->matrix44ValuesSlice(slice);
+void Matrix44RotationAxis::updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice){
+	SliceView<Imath::M44f> matrix = _matrix->value()->matrix44ValuesSlice(slice);
 	int size = matrix.size();
-	std::vector<Imath::V3f> axisXValues(size);
-	std::vector<Imath::V3f> axisYValues(size);
-	std::vector<Imath::V3f> axisZValues(size);
 	
-	for(int i = 0; i < size; ++i){
-		const Imath::M44f &mat = matrix[i];
-		axisXValues[i] = Imath::V3f(mat[0][0], mat[0][1], mat[0][2]);
-		axisYValues[i] = Imath::V3f(mat[1][0], mat[1][1], mat[1][2]);
-		axisZValues[i] = Imath::V3f(mat[2][0], mat[2][1], mat[2][2]);
+	for(int i = 0; i < outputs.size(); ++i){
+		NumericAttribute *output = (NumericAttribute*)outputs[i];
+		int row = output == _axisX ? 0 : (output == _axisY ? 1 : 2);
+		
+		std::vector<Imath::V3f> axisValues(size);
+		for(int j = 0; j < size; ++j){
+			const Imath::M44f &mat = matrix[j];
+			axisValues[j] = Imath::V3f(mat[row][0], mat[row][1], mat[row][2]);
+		}
+		
+		output->outValue()->setVec3ValuesSlice(slice, axisValues);
 	}
-	
-	_axisX->outValue()->setVec3ValuesSlice(slice, axisXValues);
-	_axisY->outValue()->setVec3ValuesSlice(slice, axisYValues);
-	_axisZ->outValue()->setVec3ValuesSlice(slice, axisZValues);
-	
-	setAttributeIsClean(_axisX, true);
-	setAttributeIsClean(_axisY, true);
-	setAttributeIsClean(_axisZ, true);
 }
 
 Matrix44FromVectors::Matrix44FromVectors(const std::string &name, Node* parent): Node(name, parent){	
@@ -1517,7 +1467,7 @@ void Matrix44FromVectors::updateSlice(Attribute *attribute, unsigned int slice){
 	if(minorSize < 1)
 		minorSize = 1;
 		
-	std::vector<Imath::M44f> matrixValues(minorSize);
+	SliceWriter<Imath::M44f> matrixValues = _matrix->outValue()->writeMatrix44ValuesSlice(slice, minorSize);
 	for(int i = 0; i < minorSize; ++i){
 		Imath::V3f translationValue = translation->vec3ValueAtSlice(slice, i);
 		Imath::V3f scaleValue = scale->vec3ValueAtSlice(slice, i);
@@ -1532,8 +1482,6 @@ void Matrix44FromVectors::updateSlice(Attribute *attribute, unsigned int slice){
 			axisZValue.x, axisZValue.y, axisZValue.z, 0.0,
 			translationValue.x, translationValue.y, translationValue.z, 1.0);
 	}
-	
-	_matrix->outValue()->setMatrix44ValuesSlice(slice, matrixValues);
 }
 
 Matrix44EulerRotation::Matrix44EulerRotation(const std::string &name, Node* parent): Node(name, parent){	
@@ -1576,10 +1524,10 @@ void Matrix44EulerRotation::updateSpecializationLink(Attribute *attributeA, Attr
 }
 
 void Matrix44EulerRotation::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<Imath::M44f> &matrix = _matrix->value()->matrix44ValuesSlice(slice);
+	SliceView<Imath::M44f> matrix = _matrix->value()->matrix44ValuesSlice(slice);
 	int size = matrix.size();
 	
-	std::vector<Imath::V3f> eulerAngles(size);
+	SliceWriter<Imath::V3f> eulerAngles = _eulerAngles->outValue()->writeVec3ValuesSlice(slice, size);
 	
 	Imath::Eulerf euler;
 	float degree = (180 / M_PI);
@@ -1591,8 +1539,6 @@ void Matrix44EulerRotation::updateSlice(Attribute *attribute, unsigned int slice
 		currentValue.y = euler.y * degree;
 		currentValue.z = euler.z * degree;
 	}
-	
-	_eulerAngles->outValue()->setVec3ValuesSlice(slice, eulerAngles);
 }
 
 RangeLoop::RangeLoop(const std::string &name, Node* parent): 
@@ -1646,7 +1592,7 @@ void RangeLoop::updateFloatArray(Numeric *start, Numeric *end, Numeric *step, Nu
 	if(minorSize < 1)
 		minorSize = 1;
 	
-	std::vector<float> outVals(minorSize);
+	SliceWriter<float> outVals = out->writeFloatValuesSlice(slice, minorSize);
 	for(int i = 0; i < minorSize; ++i){
 		float startVal = start->floatValueAtSlice(slice, i);
 		float endVal = end->floatValueAtSlice(slice, i);
@@ -1654,8 +1600,6 @@ void RangeLoop::updateFloatArray(Numeric *start, Numeric *end, Numeric *step, Nu
 
 		outVals[i] = fmod((stepVal + startVal), endVal);
 	}
-	
-	out->setFloatValuesSlice(slice, outVals);
 }
 
 void RangeLoop::updateInt(Numeric *start, Numeric *end, Numeric *step, Numeric *out, unsigned int slice){
@@ -1678,7 +1622,7 @@ void RangeLoop::updateIntArray(Numeric *start, Numeric *end, Numeric *step, Nume
 	if(minorSize < 1)
 		minorSize = 1;
 	
-	std::vector<int> outVals(minorSize);
+	SliceWriter<int> outVals = out->writeIntValuesSlice(slice, minorSize);
 	for(int i = 0; i < minorSize; ++i){
 		int startVal = start->intValueAtSlice(slice, i);
 		int endVal = end->intValueAtSlice(slice, i);
@@ -1691,8 +1635,6 @@ void RangeLoop::updateIntArray(Numeric *start, Numeric *end, Numeric *step, Nume
 
 		outVals[i] = outVal;
 	}
-	
-	out->setIntValuesSlice(slice, outVals);
 }
 
 void RangeLoop::attributeSpecializationChanged(Attribute *attribute){
@@ -1807,15 +1749,13 @@ void RandomNumber::updateFloatArray(Numeric *min, Numeric *max, Numeric *out, un
 		minorSize = 1;
 	
 	srand(_seed->value()->intValueAtSlice(slice, 0));
-	std::vector<float> outVals(minorSize);
+	SliceWriter<float> outVals = out->writeFloatValuesSlice(slice, minorSize);
 	for(int i = 0; i < minorSize; ++i){
 		float minVal = min->floatValueAtSlice(slice, i);
 		float maxVal = max->floatValueAtSlice(slice, i);
 		
 		outVals[i] =  ((float(rand()) / float(RAND_MAX)) * (maxVal - minVal)) + minVal;
 	}
-	
-	out->setFloatValuesSlice(slice, outVals);
 }
 
 void RandomNumber::updateInt(Numeric *min, Numeric *max, Numeric *out, unsigned int slice){
@@ -1840,15 +1780,13 @@ void RandomNumber::updateIntArray(Numeric *min, Numeric *max, Numeric *out, unsi
 		minorSize = 1;
 	
 	srand(_seed->value()->intValueAtSlice(slice, 0));
-	std::vector<int> outVals(minorSize);
+	SliceWriter<int> outVals = out->writeIntValuesSlice(slice, minorSize);
 	for(int i = 0; i < minorSize; ++i){
 		int minVal = min->intValueAtSlice(slice, i);
 		int maxVal = max->intValueAtSlice(slice, i);
 		
 		outVals[i] = minVal + (int) (maxVal - minVal + 1)*(rand() / (RAND_MAX + 1.0));
 	}
-	
-	out->setIntValuesSlice(slice, outVals);
 }
 
 void RandomNumber::updateSlice(Attribute *attribute, unsigned int slice){
@@ -1885,13 +1823,7 @@ ArrayIndices::ArrayIndices(const std::string &name, Node* parent): Node(name, pa
 
 void ArrayIndices::updateSlice(Attribute *attribute, unsigned int slice){
 	int arraySize = _array->value()->sizeSlice(slice);
-	std::vector<int> indices(arraySize);
-	
-	for(int i = 0; i < arraySize; ++i){
-		indices[i] = i;
-	}
-	
-	_indices->outValue()->setIntValuesSlice(slice, indices);
+	_indices->outValue()->setIntRangeSlice(slice, 0, 1, arraySize);
 }
 
 GetArrayElement::GetArrayElement(const std::string &name, Node *parent): 
@@ -2043,50 +1975,50 @@ void GetArrayElement::attributeSpecializationChanged(Attribute *attribute){
 	}
 }
 
-void GetArrayElement::updateInt(Numeric *array, const std::vector<int> &index, Numeric *element, unsigned int slice){
+void GetArrayElement::updateInt(Numeric *array, const SliceView<int> &index, Numeric *element, unsigned int slice){
 	int size = index.size();
-	element->resize(size);
+	SliceWriter<int> values = element->writeIntValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
-		element->setIntValueAtSlice(slice, i, array->intValueAtSlice(slice, index[i]));
+		values[i] = array->intValueAtSlice(slice, index[i]);
 	}
 }
 
-void GetArrayElement::updateFloat(Numeric *array,  const std::vector<int> &index, Numeric *element, unsigned int slice){
+void GetArrayElement::updateFloat(Numeric *array,  const SliceView<int> &index, Numeric *element, unsigned int slice){
 	int size = index.size();
-	element->resize(size);
+	SliceWriter<float> values = element->writeFloatValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
-		element->setFloatValueAtSlice(slice, i, array->floatValueAtSlice(slice, index[i]));
+		values[i] = array->floatValueAtSlice(slice, index[i]);
 	}
 }
 
-void GetArrayElement::updateVec3(Numeric *array,  const std::vector<int> &index, Numeric *element, unsigned int slice){
+void GetArrayElement::updateVec3(Numeric *array,  const SliceView<int> &index, Numeric *element, unsigned int slice){
 	int size = index.size();
-	element->resize(size);
+	SliceWriter<Imath::V3f> values = element->writeVec3ValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
-		element->setVec3ValueAtSlice(slice, i, array->vec3ValueAtSlice(slice, index[i]));
+		values[i] = array->vec3ValueAtSlice(slice, index[i]);
 	}
 }
 
-void GetArrayElement::updateCol4(Numeric *array, const std::vector<int> &index, Numeric *element, unsigned int slice){
+void GetArrayElement::updateCol4(Numeric *array, const SliceView<int> &index, Numeric *element, unsigned int slice){
 	int size = index.size();
-	element->resize(size);
+	SliceWriter<Imath::Color4f> values = element->writeCol4ValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
-		element->setCol4ValueAtSlice(slice, i, array->col4ValueAtSlice(slice, index[i]));
+		values[i] = array->col4ValueAtSlice(slice, index[i]);
 	}
 }
 
-void GetArrayElement::updateMatrix44(Numeric *array,  const std::vector<int> &index, Numeric *element, unsigned int slice){
+void GetArrayElement::updateMatrix44(Numeric *array,  const SliceView<int> &index, Numeric *element, unsigned int slice){
 	int size = index.size();
-	element->resize(size);
+	SliceWriter<Imath::M44f> values = element->writeMatrix44ValuesSlice(slice, size);
 	for(int i = 0; i < size; ++i){
-		element->setMatrix44ValueAtSlice(slice, i, array->matrix44ValueAtSlice(slice, index[i]));
+		values[i] = array->matrix44ValueAtSlice(slice, index[i]);
 	}
 }
 
 void GetArrayElement::updateSlice(Attribute *attribute, unsigned int slice){
 	if(_selectedOperation){
 		Numeric *array = _array->value();
-		std::vector<int> index = _index->value()->intValuesSlice(slice);
+		SliceView<int> index = _index->value()->intValuesSlice(slice);
 		Numeric *element = _element->outValue();
 		
 		(this->*_selectedOperation)(array, index, element, slice);
@@ -2198,75 +2130,80 @@ void SetArrayElement::attributeSpecializationChanged(Attribute *attribute){
 	}
 }
 
-void SetArrayElement::updateInt(Numeric *array, const std::vector<int> &index, Numeric *element, Numeric *outArray, unsigned int slice){
-	std::vector<int> values = array->intValuesSlice(slice);
-	int valuesSize = array->sizeSlice(slice);
+void SetArrayElement::updateInt(Numeric *array, const SliceView<int> &index, Numeric *element, Numeric *outArray, unsigned int slice){
+	SliceView<int> arrayValues = array->intValuesSlice(slice);
+	int valuesSize = arrayValues.size();
+	SliceWriter<int> values = outArray->writeIntValuesSlice(slice, valuesSize);
+	std::copy(arrayValues.begin(), arrayValues.end(), values.begin());
+	
 	for(int i = 0; i < index.size(); ++i){
 		int currentIndex = index[i];
 		if(currentIndex >= 0 && currentIndex < valuesSize){
 			values[currentIndex] = element->intValueAtSlice(slice, i);
 		}
 	}
-
-	outArray->setIntValuesSlice(slice, values);
 }
 
-void SetArrayElement::updateFloat(Numeric *array, const std::vector<int> &index, Numeric *element, Numeric *outArray, unsigned int slice){
-	std::vector<float> values = array->floatValuesSlice(slice);
-	int valuesSize = array->sizeSlice(slice);
+void SetArrayElement::updateFloat(Numeric *array, const SliceView<int> &index, Numeric *element, Numeric *outArray, unsigned int slice){
+	SliceView<float> arrayValues = array->floatValuesSlice(slice);
+	int valuesSize = arrayValues.size();
+	SliceWriter<float> values = outArray->writeFloatValuesSlice(slice, valuesSize);
+	std::copy(arrayValues.begin(), arrayValues.end(), values.begin());
+	
 	for(int i = 0; i < index.size(); ++i){
 		int currentIndex = index[i];
 		if(currentIndex >= 0 && currentIndex < valuesSize){
 			values[currentIndex] = element->floatValueAtSlice(slice, i);
 		}
 	}
-
-	outArray->setFloatValuesSlice(slice, values);
 }
 
-void SetArrayElement::updateVec3(Numeric *array, const std::vector<int> &index, Numeric *element, Numeric *outArray, unsigned int slice){
-	std::vector<Imath::V3f> values = array->vec3ValuesSlice(slice);
-	int valuesSize = array->sizeSlice(slice);
+void SetArrayElement::updateVec3(Numeric *array, const SliceView<int> &index, Numeric *element, Numeric *outArray, unsigned int slice){
+	SliceView<Imath::V3f> arrayValues = array->vec3ValuesSlice(slice);
+	int valuesSize = arrayValues.size();
+	SliceWriter<Imath::V3f> values = outArray->writeVec3ValuesSlice(slice, valuesSize);
+	std::copy(arrayValues.begin(), arrayValues.end(), values.begin());
+	
 	for(int i = 0; i < index.size(); ++i){
 		int currentIndex = index[i];
 		if(currentIndex >= 0 && currentIndex < valuesSize){
 			values[currentIndex] = element->vec3ValueAtSlice(slice, i);
 		}
 	}
-
-	outArray->setVec3ValuesSlice(slice, values);
 }
 
-void SetArrayElement::updateCol4(Numeric *array, const std::vector<int> &index, Numeric *element, Numeric *outArray, unsigned int slice){
-	std::vector<Imath::Color4f> values = array->col4ValuesSlice(slice);
-	int valuesSize = array->sizeSlice(slice);
+void SetArrayElement::updateCol4(Numeric *array, const SliceView<int> &index, Numeric *element, Numeric *outArray, unsigned int slice){
+	SliceView<Imath::Color4f> arrayValues = array->col4ValuesSlice(slice);
+	int valuesSize = arrayValues.size();
+	SliceWriter<Imath::Color4f> values = outArray->writeCol4ValuesSlice(slice, valuesSize);
+	std::copy(arrayValues.begin(), arrayValues.end(), values.begin());
+	
 	for(int i = 0; i < index.size(); ++i){
 		int currentIndex = index[i];
 		if(currentIndex >= 0 && currentIndex < valuesSize){
 			values[currentIndex] = element->col4ValueAtSlice(slice, i);
 		}
 	}
-
-	outArray->setCol4ValuesSlice(slice, values);
 }
 
-void SetArrayElement::updateMatrix44(Numeric *array, const std::vector<int> &index, Numeric *element, Numeric *outArray, unsigned int slice){
-	std::vector<Imath::M44f> values = array->matrix44ValuesSlice(slice);
-	int valuesSize = array->sizeSlice(slice);
+void SetArrayElement::updateMatrix44(Numeric *array, const SliceView<int> &index, Numeric *element, Numeric *outArray, unsigned int slice){
+	SliceView<Imath::M44f> arrayValues = array->matrix44ValuesSlice(slice);
+	int valuesSize = arrayValues.size();
+	SliceWriter<Imath::M44f> values = outArray->writeMatrix44ValuesSlice(slice, valuesSize);
+	std::copy(arrayValues.begin(), arrayValues.end(), values.begin());
+	
 	for(int i = 0; i < index.size(); ++i){
 		int currentIndex = index[i];
 		if(currentIndex >= 0 && currentIndex < valuesSize){
 			values[currentIndex] = element->matrix44ValueAtSlice(slice, i);
 		}
 	}
-
-	outArray->setMatrix44ValuesSlice(slice, values);
 }
 
 void SetArrayElement::updateSlice(Attribute *attribute, unsigned int slice){
 	if(_selectedOperation){
 		Numeric *array = _array->value();
-		const std::vector<int> &index = _index->value()->intValuesSlice(slice);
+		SliceView<int> index = _index->value()->intValuesSlice(slice);
 		Numeric *element = _element->value();
 		Numeric *outArray = _outArray->outValue();
 		
@@ -2278,6 +2215,7 @@ SetSimulationStep::SetSimulationStep(const std::string &name, Node *parent):
 Node(name, parent),
 _selectedOperation(0){
 	setSliceable(true);
+	setKeepsState(true);
 
 	_storageKey = new StringAttribute("storageKey", this);
 	_data = new NumericAttribute("data", this);
@@ -2322,33 +2260,33 @@ void SetSimulationStep::attributeSpecializationChanged(Attribute *attribute){
 }
 
 void SetSimulationStep::updateInt(const std::string &storageKey, Numeric *data, Numeric *result, unsigned int slice){
-	_globalNumericStorage[storageKey].setIntValuesSlice(slice, data->intValuesSlice(slice));
-	result->setIntValuesSlice(slice, data->intValuesSlice(slice));
+	_globalNumericStorage[storageKey].shareValuesSlice(slice, data, slice);
+	result->shareValuesSlice(slice, data, slice);
 }
 
 void SetSimulationStep::updateFloat(const std::string &storageKey, Numeric *data, Numeric *result, unsigned int slice){
-	_globalNumericStorage[storageKey].setFloatValuesSlice(slice, data->floatValuesSlice(slice));
-	result->setFloatValuesSlice(slice, data->floatValuesSlice(slice));
+	_globalNumericStorage[storageKey].shareValuesSlice(slice, data, slice);
+	result->shareValuesSlice(slice, data, slice);
 }
 
 void SetSimulationStep::updateVec3(const std::string &storageKey, Numeric *data, Numeric *result, unsigned int slice){
-	_globalNumericStorage[storageKey].setVec3ValuesSlice(slice, data->vec3ValuesSlice(slice));
-	result->setVec3ValuesSlice(slice, data->vec3ValuesSlice(slice));
+	_globalNumericStorage[storageKey].shareValuesSlice(slice, data, slice);
+	result->shareValuesSlice(slice, data, slice);
 }
 
 void SetSimulationStep::updateCol4(const std::string &storageKey, Numeric *data, Numeric *result, unsigned int slice){
-	_globalNumericStorage[storageKey].setCol4ValuesSlice(slice, data->col4ValuesSlice(slice));
-	result->setCol4ValuesSlice(slice, data->col4ValuesSlice(slice));
+	_globalNumericStorage[storageKey].shareValuesSlice(slice, data, slice);
+	result->shareValuesSlice(slice, data, slice);
 }
 
 void SetSimulationStep::updateMatrix44(const std::string &storageKey, Numeric *data, Numeric *result, unsigned int slice){
-	_globalNumericStorage[storageKey].setMatrix44ValuesSlice(slice, data->matrix44ValuesSlice(slice));
-	result->setMatrix44ValuesSlice(slice, data->matrix44ValuesSlice(slice));
+	_globalNumericStorage[storageKey].shareValuesSlice(slice, data, slice);
+	result->shareValuesSlice(slice, data, slice);
 }
 
 void SetSimulationStep::updateQuat(const std::string &storageKey, Numeric *data, Numeric *result, unsigned int slice){
-	_globalNumericStorage[storageKey].setQuatValuesSlice(slice, data->quatValuesSlice(slice));
-	result->setQuatValuesSlice(slice, data->quatValuesSlice(slice));
+	_globalNumericStorage[storageKey].shareValuesSlice(slice, data, slice);
+	result->shareValuesSlice(slice, data, slice);
 }
 
 void SetSimulationStep::resizedSlices(unsigned int slices){
@@ -2360,8 +2298,18 @@ void SetSimulationStep::updateSlice(Attribute *attribute, unsigned int slice){
 		#ifdef CORAL_PARALLEL_TBB
 			tbb::mutex::scoped_lock lock(_globalMutex); // block setting _globalNumericStorage from two different threads
 		#endif
-
-		(this->*_selectedOperation)(_storageKey->value()->stringValue(), _data->value(), _result->outValue(), slice);
+		
+		const std::string &storageKey = _storageKey->value()->stringValue();
+		Numeric *data = _data->value();
+		
+		// the storage takes the type of the data, so that its slices can share the buffers of data
+		Numeric &storage = _globalNumericStorage[storageKey];
+		if(storage.type() != data->type()){
+			storage.setType(data->type());
+			storage.resizeSlices(data->slices());
+		}
+		
+		(this->*_selectedOperation)(storageKey, data, _result->outValue(), slice);
 	}
 }
 
@@ -2369,6 +2317,7 @@ GetSimulationStep::GetSimulationStep(const std::string &name, Node *parent):
 Node(name, parent),
 _selectedOperation(0){
 	setSliceable(true);
+	setKeepsState(true);
 
 	_storageKey = new StringAttribute("storageKey", this);
 	_source = new NumericAttribute("source", this);
@@ -2421,56 +2370,56 @@ void GetSimulationStep::attributeSpecializationChanged(Attribute *attribute){
 }
 
 void GetSimulationStep::updateInt(const std::string &storageKey, int step, Numeric *source, Numeric *data, unsigned int slice){
-	if(step <= 0 || _globalNumericStorage.find(storageKey) == _globalNumericStorage.end()){
-		data->setIntValuesSlice(slice, source->intValuesSlice(slice));
+	if(step <= 0 || _globalNumericStorage.find(storageKey) == _globalNumericStorage.end() || _globalNumericStorage[storageKey].type() != source->type()){
+		data->shareValuesSlice(slice, source, slice);
 	}
 	else{
-		data->setIntValuesSlice(slice, _globalNumericStorage[storageKey].intValuesSlice(slice));
+		data->shareValuesSlice(slice, &_globalNumericStorage[storageKey], slice);
 	}
 }
 
 void GetSimulationStep::updateFloat(const std::string &storageKey, int step, Numeric *source, Numeric *data, unsigned int slice){
-	if(step <= 0 || _globalNumericStorage.find(storageKey) == _globalNumericStorage.end()){
-		data->setFloatValuesSlice(slice, source->floatValuesSlice(slice));
+	if(step <= 0 || _globalNumericStorage.find(storageKey) == _globalNumericStorage.end() || _globalNumericStorage[storageKey].type() != source->type()){
+		data->shareValuesSlice(slice, source, slice);
 	}
 	else{
-		data->setFloatValuesSlice(slice, _globalNumericStorage[storageKey].floatValuesSlice(slice));
+		data->shareValuesSlice(slice, &_globalNumericStorage[storageKey], slice);
 	}
 }
 
 void GetSimulationStep::updateVec3(const std::string &storageKey, int step, Numeric *source, Numeric *data, unsigned int slice){
-	if(step <= 0 || _globalNumericStorage.find(storageKey) == _globalNumericStorage.end()){
-		data->setVec3ValuesSlice(slice, source->vec3ValuesSlice(slice));
+	if(step <= 0 || _globalNumericStorage.find(storageKey) == _globalNumericStorage.end() || _globalNumericStorage[storageKey].type() != source->type()){
+		data->shareValuesSlice(slice, source, slice);
 	}
 	else{
-		data->setVec3ValuesSlice(slice, _globalNumericStorage[storageKey].vec3ValuesSlice(slice));
+		data->shareValuesSlice(slice, &_globalNumericStorage[storageKey], slice);
 	}
 }
 
 void GetSimulationStep::updateCol4(const std::string &storageKey, int step, Numeric *source, Numeric *data, unsigned int slice){
-	if(step <= 0 || _globalNumericStorage.find(storageKey) == _globalNumericStorage.end()){
-		data->setCol4ValuesSlice(slice, source->col4ValuesSlice(slice));
+	if(step <= 0 || _globalNumericStorage.find(storageKey) == _globalNumericStorage.end() || _globalNumericStorage[storageKey].type() != source->type()){
+		data->shareValuesSlice(slice, source, slice);
 	}
 	else{
-		data->setCol4ValuesSlice(slice, _globalNumericStorage[storageKey].col4ValuesSlice(slice));
+		data->shareValuesSlice(slice, &_globalNumericStorage[storageKey], slice);
 	}
 }
 
 void GetSimulationStep::updateMatrix44(const std::string &storageKey, int step, Numeric *source, Numeric *data, unsigned int slice){
-	if(step <= 0 || _globalNumericStorage.find(storageKey) == _globalNumericStorage.end()){
-		data->setMatrix44ValuesSlice(slice, source->matrix44ValuesSlice(slice));
+	if(step <= 0 || _globalNumericStorage.find(storageKey) == _globalNumericStorage.end() || _globalNumericStorage[storageKey].type() != source->type()){
+		data->shareValuesSlice(slice, source, slice);
 	}
 	else{
-		data->setMatrix44ValuesSlice(slice, _globalNumericStorage[storageKey].matrix44ValuesSlice(slice));
+		data->shareValuesSlice(slice, &_globalNumericStorage[storageKey], slice);
 	}
 }
 
 void GetSimulationStep::updateQuat(const std::string &storageKey, int step, Numeric *source, Numeric *data, unsigned int slice){
-	if(step <= 0 || _globalNumericStorage.find(storageKey) == _globalNumericStorage.end()){
-		data->setQuatValuesSlice(slice, source->quatValuesSlice(slice));
+	if(step <= 0 || _globalNumericStorage.find(storageKey) == _globalNumericStorage.end() || _globalNumericStorage[storageKey].type() != source->type()){
+		data->shareValuesSlice(slice, source, slice);
 	}
 	else{
-		data->setQuatValuesSlice(slice, _globalNumericStorage[storageKey].quatValuesSlice(slice));
+		data->shareValuesSlice(slice, &_globalNumericStorage[storageKey], slice);
 	}
 }
 
@@ -2492,6 +2441,7 @@ void GetSimulationStep::updateSlice(Attribute *attribute, unsigned int slice){
 
 QuatToAxisAngle::QuatToAxisAngle(const std::string &name, Node *parent): Node(name, parent){
 	setSliceable(true);
+	setUpdateOutputsTogether(true);
 
 	_quat = new NumericAttribute("quat",this);
 	_axis = new NumericAttribute("axis",this);
@@ -2549,25 +2499,29 @@ void QuatToAxisAngle::updateSpecializationLink(Attribute *attributeA, Attribute
 	}
 }
 
-void QuatToAxisAngle::updateSlice(Attribute *attribute, unsigned int slice)
+void QuatToAxisAngle::updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice)
 {
-	const std::vector<Imath::Quatf> &quatValues = _quat->value()->quatValuesSlice(slice);
+	SliceView<Imath::Quatf> quatValues = _quat->value()->quatValuesSlice(slice);
 	int size = quatValues.size();
 
-	std::vector<Imath::V3f> axisValues(size);
-	std::vector<float> angleValues(size);
-
-	for(int i = 0; i < size; ++i){
-		const Imath::Quatf &quat = quatValues[i];
-		axisValues[i] = quat.axis();
-		angleValues[i] =quat.angle();
+	for(int i = 0; i < outputs.size(); ++i){
+		if(outputs[i] == _axis){
+			std::vector<Imath::V3f> axisValues(size);
+			for(int j = 0; j < size; ++j){
+				axisValues[j] = quatValues[j].axis();
+			}
+			
+			_axis->outValue()->setVec3ValuesSlice(slice, axisValues);
+		}
+		else{
+			std::vector<float> angleValues(size);
+			for(int j = 0; j < size; ++j){
+				angleValues[j] = quatValues[j].angle();
+			}
+			
+			_angle->outValue()->setFloatValuesSlice(slice, angleValues);
+		}
 	}
-
-	_axis->outValue()->setVec3ValuesSlice(slice, axisValues);
-	_angle->outValue()->setFloatValuesSlice(slice, angleValues);
-
-	setAttributeIsClean(_axis, true);
-	setAttributeIsClean(_angle, true);
 }
 
 QuatToEulerRotation::QuatToEulerRotation(const std::string &name, Node *parent): Node(name, parent){
@@ -2622,10 +2576,10 @@ void QuatToEulerRotation::updateSpecializationLink(Attribute *attributeA, Attrib
 
 void QuatToEulerRotation::updateSlice(Attribute *attribute, unsigned int slice)
 {
-	const std::vector<Imath::Quatf> &quatValues = _quat->value()->quatValuesSlice(slice);
+	SliceView<Imath::Quatf> quatValues = _quat->value()->quatValuesSlice(slice);
 	int size = quatValues.size();
 
-	std::vector<Imath::V3f> eulerValues(size);
+	SliceWriter<Imath::V3f> eulerValues = _euler->outValue()->writeVec3ValuesSlice(slice, size);
 
 	float degree = (180 / M_PI);
 	Imath::Eulerf euler;
@@ -2642,8 +2596,6 @@ void QuatToEulerRotation::updateSlice(Attribute *attribute, unsigned int slice)
 		eulerValues[i].z = euler.z * degree;
 	}
 
-	_euler->outValue()->setVec3ValuesSlice(slice, eulerValues);
-
 	setAttributeIsClean(_euler, true);
 }
 
@@ -2697,10 +2649,10 @@ void QuatToMatrix44::updateSpecializationLink(Attribute *attributeA, Attribute *
 }
 
 void QuatToMatrix44::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<Imath::Quatf> &quatValues = _quat->value()->quatValuesSlice(slice);
+	SliceView<Imath::Quatf> quatValues = _quat->value()->quatValuesSlice(slice);
 	int size = quatValues.size();
 
-	std::vector<Imath::M44f> matrixValues(size);
+	SliceWriter<Imath::M44f> matrixValues = _matrix->outValue()->writeMatrix44ValuesSlice(slice, size);
 
 	for(int i = 0; i < size; ++i){
 		Imath::Quatf quat = quatValues[i];
@@ -2708,8 +2660,6 @@ void QuatToMatrix44::updateSlice(Attribute *attribute, unsigned int slice){
 		matrixValues[i] = quat.toMatrix44();
 	}
 
-	_matrix->outValue()->setMatrix44ValuesSlice(slice, matrixValues);
-
 	setAttributeIsClean(_matrix, true);
 }
 
@@ -2763,7 +2713,7 @@ void Matrix44ToQuat::updateSpecializationLink(Attribute *attributeA, Attribute *
 }
 
 void Matrix44ToQuat::updateSlice(Attribute *attribute, unsigned int slice){
-	const std::vector<Imath::M44f> &mtxValues = _matrix->value()->matrix44ValuesSlice(slice);
+	SliceView<Imath::M44f> mtxValues = _matrix->value()->matrix44ValuesSlice(slice);
 	int size = mtxValues.size();
 
 	std::vector<Imath::Quatf> quatValues(size);
@@ -71,7 +71,7 @@ private:
 class Vec3ToFloats: public Node{
 public:
 	Vec3ToFloats(const std::string &name, Node *parent);
-	void updateSlice(Attribute *attribute, unsigned int slice);
+	void updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice);
 	void updateSpecializationLink(Attribute *attributeA, Attribute *attributeB, std::vector<std::string> &specializationA, std::vector<std::string> &specializationB);
 	
 private:
@@ -98,7 +98,7 @@ private:
 class Col4ToFloats: public Node{
 public:
 	Col4ToFloats(const std::string &name, Node *parent);
-	void updateSlice(Attribute *attribute, unsigned int slice);
+	void updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice);
 	void updateSpecializationLink(Attribute *attributeA, Attribute *attributeB, std::vector<std::string> &specializationA, std::vector<std::string> &specializationB);
 
 private:
@@ -138,7 +138,7 @@ private:
 class QuatToFloats: public Node{
 public:
 	QuatToFloats(const std::string &name, Node *parent);
-	void updateSlice(Attribute *attribute, unsigned int slice);
+	void updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice);
 	void updateSpecializationLink(Attribute *attributeA, Attribute *attributeB, std::vector<std::string> &specializationA, std::vector<std::string> &specializationB);
 
 private:
@@ -208,6 +208,17 @@ private:
 	void updateMatrix44(const std::vector<Attribute*> &inAttrs, int arraySize, Numeric *array, unsigned int slice);
 };
 
+//! Maps a raw binary file of values as an array, the pages of the file are read from disk only when accessed.
+class MappedArray: public Node{
+public:
+	MappedArray(const std::string &name, Node *parent);
+	void updateSlice(Attribute *attribute, unsigned int slice);
+	
+private:
+	StringAttribute *_fileName;
+	NumericAttribute *_array;
+};
+
 class RangeArray: public Node{
 public:
 	RangeArray(const std::string &name, Node *parent);
@@ -240,7 +251,7 @@ class Matrix44RotationAxis: public Node{
 public:
 	Matrix44RotationAxis(const std::string &name, Node *parent);
 	void updateSpecializationLink(Attribute *attributeA, Attribute *attributeB, std::vector<std::string> &specializationA, std::vector<std::string> &specializationB);
-	void updateSlice(Attribute *attribute, unsigned int slice);
+	void updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice);
 	
 private:
 	NumericAttribute *_matrix;
@@ -334,13 +345,13 @@ private:
 	NumericAttribute *_array;
 	NumericAttribute *_index;
 	NumericAttribute *_element;
-	void(GetArrayElement::*_selectedOperation)(Numeric *, const std::vector<int> &, Numeric *, unsigned int);
+	void(GetArrayElement::*_selectedOperation)(Numeric *, const SliceView<int> &, Numeric *, unsigned int);
 	
-	void updateInt(Numeric *array, const std::vector<int> &index, Numeric *element, unsigned int slice);
-	void updateFloat(Numeric *array, const std::vector<int> &index, Numeric *element, unsigned int slice);
-	void updateVec3(Numeric *array, const std::vector<int> &index, Numeric *element, unsigned int slice);
-	void updateCol4(Numeric *array, const std::vector<int> &index, Numeric *element, unsigned int slice);
-	void updateMatrix44(Numeric *array, const std::vector<int> &index, Numeric *element, unsigned int slice);
+	void updateInt(Numeric *array, const SliceView<int> &index, Numeric *element, unsigned int slice);
+	void updateFloat(Numeric *array, const SliceView<int> &index, Numeric *element, unsigned int slice);
+	void updateVec3(Numeric *array, const SliceView<int> &index, Numeric *element, unsigned int slice);
+	void updateCol4(Numeric *array, const SliceView<int> &index, Numeric *element, unsigned int slice);
+	void updateMatrix44(Numeric *array, const SliceView<int> &index, Numeric *element, unsigned int slice);
 };
 
 class SetArrayElement: public Node{
@@ -355,13 +366,13 @@ private:
 	NumericAttribute *_index;
 	NumericAttribute *_element;
 	NumericAttribute *_outArray;
-	void(SetArrayElement::*_selectedOperation)(Numeric *, const std::vector<int> &, Numeric *, Numeric *, unsigned int);
+	void(SetArrayElement::*_selectedOperation)(Numeric *, const SliceView<int> &, Numeric *, Numeric *, unsigned int);
 
-	void updateInt(Numeric *array, const std::vector<int> &index, Numeric *element, Numeric *outArray, unsigned int slice);
-	void updateFloat(Numeric *array, const std::vector<int> &index, Numeric *element, Numeric *outArray, unsigned int slice);
-	void updateVec3(Numeric *array, const std::vector<int> &index, Numeric *element, Numeric *outArray, unsigned int slice);
-	void updateCol4(Numeric *array, const std::vector<int> &index, Numeric *element, Numeric *outArray, unsigned int slice);
-	void updateMatrix44(Numeric *array, const std::vector<int> &index, Numeric *element, Numeric *outArray, unsigned int slice);
+	void updateInt(Numeric *array, const SliceView<int> &index, Numeric *element, Numeric *outArray, unsigned int slice);
+	void updateFloat(Numeric *array, const SliceView<int> &index, Numeric *element, Numeric *outArray, unsigned int slice);
+	void updateVec3(Numeric *array, const SliceView<int> &index, Numeric *element, Numeric *outArray, unsigned int slice);
+	void updateCol4(Numeric *array, const SliceView<int> &index, Numeric *element, Numeric *outArray, unsigned int slice);
+	void updateMatrix44(Numeric *array, const SliceView<int> &index, Numeric *element, Numeric *outArray, unsigned int slice);
 };
 
 class SetSimulationStep: public Node{
@@ -412,7 +423,7 @@ class QuatToAxisAngle: public Node
 public:
 	QuatToAxisAngle(const std::string &name, Node *parent);
 	void updateSpecializationLink(Attribute *attributeA, Attribute *attributeB, std::vector<std::string> &specializationA, std::vector<std::string> &specializationB);
-	void updateSlice(Attribute *attribute, unsigned int slice);
+	void updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice);
 
 private:
 	NumericAttribute *_quat;
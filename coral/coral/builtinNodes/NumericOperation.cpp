@@ -45,8 +45,8 @@ namespace{
 	Numeric::Type numeric_type_matrix44_array = Numeric::numericTypeMatrix44Array;
 
 	template<class type>
-	unsigned int getSliceInBounds(std::vector<std::vector<type> > &vec, unsigned int slice){
-		unsigned int size = vec.size();
+	unsigned int getSliceInBounds(const SlicedValues<type> &values, unsigned int slice){
+		unsigned int size = values.slices();
 		if(slice >= size){
 			return size - 1;
 		}
@@ -59,23 +59,32 @@ namespace{
 	void NumericOperation::operation_##operation##_##typeA##_##typeB##_array_to_array(Numeric *operandA, Numeric *operandB, Numeric *result, unsigned int slice){ \
 		unsigned int sliceA = getSliceInBounds<typeA>(operandA->_##typeA##ValuesSliced, slice); \
 		unsigned int sliceB = getSliceInBounds<typeB>(operandB->_##typeB##ValuesSliced, slice); \
-		numericOperation_##operation##ArrayToArray<typeA, typeB>(operandA->_##typeA##ValuesSliced[sliceA], operandB->_##typeB##ValuesSliced[sliceB], result->_##typeA##ValuesSliced[slice]); \
+		if(numericOperation_uniform<typeA, typeB>(&numericOperation_##operation##ArrayToArray<typeA, typeB>, operandA->_##typeA##ValuesSliced, sliceA, operandB->_##typeB##ValuesSliced, sliceB, true, result->_##typeA##ValuesSliced, slice)){ \
+			return; \
+		} \
+		SliceWriter<typeA> resultWriter(result->_##typeA##ValuesSliced, slice); \
+		numericOperation_##operation##ArrayToArray<typeA, typeB>(operandA->_##typeA##ValuesSliced.slice(sliceA), operandB->_##typeB##ValuesSliced.slice(sliceB), resultWriter); \
 	} \
 	void NumericOperation::operation_##operation##_##typeA##_##typeB##_single_to_array(Numeric *operandA, Numeric *operandB, Numeric *result, unsigned int slice){ \
 		unsigned int sliceA = getSliceInBounds<typeA>(operandA->_##typeA##ValuesSliced, slice); \
 		unsigned int sliceB = getSliceInBounds<typeB>(operandB->_##typeB##ValuesSliced, slice); \
-		numericOperation_##operation##SingleToArray<typeA, typeB>(operandA->_##typeA##ValuesSliced[sliceA], operandB->_##typeB##ValuesSliced[sliceB], result->_##typeA##ValuesSliced[slice]); \
+		SliceWriter<typeA> resultWriter(result->_##typeA##ValuesSliced, slice); \
+		numericOperation_##operation##SingleToArray<typeA, typeB>(operandA->_##typeA##ValuesSliced.slice(sliceA), operandB->_##typeB##ValuesSliced.slice(sliceB), resultWriter); \
 	} \
 	void NumericOperation::operation_##operation##_##typeA##_##typeB##_array_to_single(Numeric *operandA, Numeric *operandB, Numeric *result, unsigned int slice){ \
 		unsigned int sliceA = getSliceInBounds<typeA>(operandA->_##typeA##ValuesSliced, slice); \
 		unsigned int sliceB = getSliceInBounds<typeB>(operandB->_##typeB##ValuesSliced, slice); \
-		numericOperation_##operation##ArrayToSingle<typeA, typeB>(operandA->_##typeA##ValuesSliced[sliceA], operandB->_##typeB##ValuesSliced[sliceB], result->_##typeA##ValuesSliced[slice]); \
+		if(numericOperation_uniform<typeA, typeB>(&numericOperation_##operation##ArrayToSingle<typeA, typeB>, operandA->_##typeA##ValuesSliced, sliceA, operandB->_##typeB##ValuesSliced, sliceB, false, result->_##typeA##ValuesSliced, slice)){ \
+			return; \
+		} \
+		SliceWriter<typeA> resultWriter(result->_##typeA##ValuesSliced, slice); \
+		numericOperation_##operation##ArrayToSingle<typeA, typeB>(operandA->_##typeA##ValuesSliced.slice(sliceA), operandB->_##typeB##ValuesSliced.slice(sliceB), resultWriter); \
 	} \
 
 #define DEFINE_PASSTRHOUGH_OPERATION(type) \
 	void NumericOperation::operation_##type##_passThrough(Numeric *operandA, Numeric *operandB, Numeric *result, unsigned int slice){ \
 		unsigned int sliceA = getSliceInBounds<type>(operandA->_##type##ValuesSliced, slice); \
-		numericOperation_passThrough<type>(operandA->_##type##ValuesSliced[sliceA], result->_##type##ValuesSliced[slice]); \
+		numericOperation_passThrough<type>(operandA->_##type##ValuesSliced, sliceA, result->_##type##ValuesSliced, slice); \
 	} \
 
 #define SELECT_NUMERIC_OPERATION(operation, typeNameA, typeNameB) \
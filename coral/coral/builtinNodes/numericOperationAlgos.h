@@ -37,13 +37,63 @@ typedef Imath::M44f matrix44;
 
 using namespace coral;
 
+// shares the values of sliceA, an array gets copied only if one of the two is written to later
 template <class type>
-void numericOperation_passThrough(const std::vector<type> &containerA, std::vector<type> &resultContainer){
-	resultContainer = containerA;
+void numericOperation_passThrough(const SlicedValues<type> &valuesA, unsigned int sliceA, SlicedValues<type> &resultValues, unsigned int slice){
+	resultValues.setSlice(slice, valuesA, sliceA);
 }
 
+// operands stored as uniform slices, see SlicedValues::setUniformSlice(), are computed on their one value 
+// and the result is stored uniform too, the kernel still does the actual operation on single element views.
+// Returns false if the operands are not uniform, operandB must be uniform as well unless it's a single value.
 template <class TypeA, class TypeB>
-void numericOperation_addArrayToSingle(const std::vector<TypeA> &containerA, const std::vector<TypeB> &containerB, std::vector<TypeA> &resultContainer){
+bool numericOperation_uniform(
+	void(*kernel)(const SliceView<TypeA> &, const SliceView<TypeB> &, SliceWriter<TypeA> &), 
+	const SlicedValues<TypeA> &valuesA, unsigned int sliceA, 
+	const SlicedValues<TypeB> &valuesB, unsigned int sliceB, bool operandBIsArray, 
+	SlicedValues<TypeA> &resultValues, unsigned int slice){
+	
+	if(!valuesA.isImplicit(sliceA) || valuesA.implicitSlice(sliceA).isRange){
+		return false;
+	}
+	
+	const ImplicitSlice<TypeA> &uniformA = valuesA.implicitSlice(sliceA);
+	unsigned int size = uniformA.size;
+	SliceView<TypeB> viewB;
+	
+	if(operandBIsArray){
+		if(!valuesB.isImplicit(sliceB) || valuesB.implicitSlice(sliceB).isRange){
+			return false;
+		}
+		
+		const ImplicitSlice<TypeB> &uniformB = valuesB.implicitSlice(sliceB);
+		if(uniformB.size < size){
+			size = uniformB.size;
+		}
+		
+		viewB = SliceView<TypeB>(&uniformB.first, 1);
+	}
+	else{
+		viewB = valuesB.slice(sliceB);
+		if(viewB.size() == 0){
+			return false;
+		}
+	}
+	
+	// an implicit result left by the previous evaluation would be expanded by the writer only to be overwritten
+	resultValues.setUniformSlice(slice, uniformA.first, 1);
+	
+	SliceWriter<TypeA> resultWriter(resultValues, slice);
+	kernel(SliceView<TypeA>(&uniformA.first, 1), viewB, resultWriter);
+	
+	TypeA value = resultWriter[0];
+	resultValues.setUniformSlice(slice, value, size);
+	
+	return true;
+}
+
+template <class TypeA, class TypeB>
+void numericOperation_addArrayToSingle(const SliceView<TypeA> &containerA, const SliceView<TypeB> &containerB, SliceWriter<TypeA> &resultContainer){
 	if(containerB.size()){
 		resultContainer.resize(containerA.size());
 
@@ -55,7 +105,7 @@ void numericOperation_addArrayToSingle(const std::vector<TypeA> &containerA, con
 }
 
 template <class TypeA, class TypeB>
-void numericOperation_addArrayToArray(const std::vector<TypeA> &containerA, const std::vector<TypeB> &containerB, std::vector<TypeA> &resultContainer){
+void numericOperation_addArrayToArray(const SliceView<TypeA> &containerA, const SliceView<TypeB> &containerB, SliceWriter<TypeA> &resultContainer){
 	int sizeA = containerA.size();
 	int sizeB = containerB.size();
 	
@@ -72,7 +122,7 @@ void numericOperation_addArrayToArray(const std::vector<TypeA> &containerA, cons
 }
 
 template <class TypeA, class TypeB>
-void numericOperation_addSingleToArray(const std::vector<TypeA> &containerA, const std::vector<TypeB> &containerB, std::vector<TypeA> &resultContainer){
+void numericOperation_addSingleToArray(const SliceView<TypeA> &containerA, const SliceView<TypeB> &containerB, SliceWriter<TypeA> &resultContainer){
 	if(containerA.size()){
 		TypeA valueA = containerA[0];
 		resultContainer.resize(1);
@@ -86,7 +136,7 @@ void numericOperation_addSingleToArray(const std::vector<TypeA> &containerA, con
 }
 
 template <class TypeA, class TypeB>
-void numericOperation_subArrayToSingle(const std::vector<TypeA> &containerA, const std::vector<TypeB> &containerB, std::vector<TypeA> &resultContainer){
+void numericOperation_subArrayToSingle(const SliceView<TypeA> &containerA, const SliceView<TypeB> &containerB, SliceWriter<TypeA> &resultContainer){
 	if(containerB.size()){
 		resultContainer.resize(containerA.size());
 
@@ -98,7 +148,7 @@ void numericOperation_subArrayToSingle(const std::vector<TypeA> &containerA, con
 }
 
 template <class TypeA, class TypeB>
-void numericOperation_subSingleToArray(const std::vector<TypeA> &containerA, const std::vector<TypeB> &containerB, std::vector<TypeA> &resultContainer){
+void numericOperation_subSingleToArray(const SliceView<TypeA> &containerA, const SliceView<TypeB> &containerB, SliceWriter<TypeA> &resultContainer){
 	if(containerA.size()){
 		TypeA valueA = containerA[0];
 		resultContainer.resize(1);
@@ -112,7 +162,7 @@ void numericOperation_subSingleToArray(const std::vector<TypeA> &containerA, con
 }
 
 template <class TypeA, class TypeB>
-void numericOperation_subArrayToArray(const std::vector<TypeA> &containerA, const std::vector<TypeB> &containerB, std::vector<TypeA> &resultContainer){
+void numericOperation_subArrayToArray(const SliceView<TypeA> &containerA, const SliceView<TypeB> &containerB, SliceWriter<TypeA> &resultContainer){
 	int sizeA = containerA.size();
 	int sizeB = containerB.size();
 	
@@ -129,7 +179,7 @@ void numericOperation_subArrayToArray(const std::vector<TypeA> &containerA, cons
 }
 
 template <class TypeA, class TypeB>
-void numericOperation_mulArrayToSingle(const std::vector<TypeA> &containerA, const std::vector<TypeB> &containerB, std::vector<TypeA> &resultContainer){
+void numericOperation_mulArrayToSingle(const SliceView<TypeA> &containerA, const SliceView<TypeB> &containerB, SliceWriter<TypeA> &resultContainer){
 	if(containerB.size()){
 		resultContainer.resize(containerA.size());
 		
@@ -141,7 +191,7 @@ void numericOperation_mulArrayToSingle(const std::vector<TypeA> &containerA, con
 }
 
 template <class TypeA, class TypeB>
-void numericOperation_mulSingleToArray(const std::vector<TypeA> &containerA, const std::vector<TypeB> &containerB, std::vector<TypeA> &resultContainer){
+void numericOperation_mulSingleToArray(const SliceView<TypeA> &containerA, const SliceView<TypeB> &containerB, SliceWriter<TypeA> &resultContainer){
 	if(containerA.size()){
 		TypeA valueA = containerA[0];
 		resultContainer.resize(1);
@@ -155,7 +205,7 @@ void numericOperation_mulSingleToArray(const std::vector<TypeA> &containerA, con
 }
 
 template <class TypeA, class TypeB>
-void numericOperation_mulArrayToArray(const std::vector<TypeA> &containerA, const std::vector<TypeB> &containerB, std::vector<TypeA> &resultContainer){
+void numericOperation_mulArrayToArray(const SliceView<TypeA> &containerA, const SliceView<TypeB> &containerB, SliceWriter<TypeA> &resultContainer){
 	int sizeA = containerA.size();
 	int sizeB = containerB.size();
 	
@@ -172,7 +222,7 @@ void numericOperation_mulArrayToArray(const std::vector<TypeA> &containerA, cons
 }
 
 template <class TypeA, class TypeB>
-void numericOperation_divArrayToSingle(const std::vector<TypeA> &containerA, const std::vector<TypeB> &containerB, std::vector<TypeA> &resultContainer){
+void numericOperation_divArrayToSingle(const SliceView<TypeA> &containerA, const SliceView<TypeB> &containerB, SliceWriter<TypeA> &resultContainer){
 	if(containerB.size()){
 		resultContainer.resize(containerA.size());
 		
@@ -184,7 +234,7 @@ void numericOperation_divArrayToSingle(const std::vector<TypeA> &containerA, con
 }
 
 template <class TypeA, class TypeB>
-void numericOperation_divSingleToArray(const std::vector<TypeA> &containerA, const std::vector<TypeB> &containerB, std::vector<TypeA> &resultContainer){
+void numericOperation_divSingleToArray(const SliceView<TypeA> &containerA, const SliceView<TypeB> &containerB, SliceWriter<TypeA> &resultContainer){
 	if(containerA.size()){
 		TypeA valueA = containerA[0];
 		resultContainer.resize(1);
@@ -198,7 +248,7 @@ void numericOperation_divSingleToArray(const std::vector<TypeA> &containerA, con
 }
 
 template <class TypeA, class TypeB>
-void numericOperation_divArrayToArray(const std::vector<TypeA> &containerA, const std::vector<TypeB> &containerB, std::vector<TypeA> &resultContainer){
+void numericOperation_divArrayToArray(const SliceView<TypeA> &containerA, const SliceView<TypeB> &containerB, SliceWriter<TypeA> &resultContainer){
 	int sizeA = containerA.size();
 	int sizeB = containerB.size();
 	
@@ -53,6 +53,7 @@ def loadPlugin():
     plugin.registerNode("ArraySize", _coral.ArraySize, tags = ["numeric"], description = "Get the size of a numeric array")
     plugin.registerNode("BuildArray", _coral.BuildArray, tags = ["numeric"], description = "Build a numeric array by adding each individual element.")
     plugin.registerNode("RangeArray", _coral.RangeArray, tags = ["numeric"], description = "Generate an array from the given range, each element of the array is a progressive value of the range.")
+    plugin.registerNode("MappedArray", _coral.MappedArray, tags = ["numeric"], description = "Read an array from a raw binary file of values, the file is mapped in memory and loaded from disk only as it's accessed.")
     plugin.registerNode("Matrix44Translation", _coral.Matrix44Translation, tags = ["numeric"], description = "Get the translation values of a matrix44.\nWorks with single or array values.")
     plugin.registerNode("Matrix44RotationAxis", _coral.Matrix44RotationAxis, tags = ["numeric"], description = "Get each rotation axis of a matrix44 as three individual vectors.\nWorks with single or array values.")
     plugin.registerNode("Matrix44FromVectors", _coral.Matrix44FromVectors, tags = ["numeric"], description = "Build a matrix44 from vec3 values.\nWorks with single or array values.")
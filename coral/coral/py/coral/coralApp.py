@@ -437,46 +437,28 @@ def rootNode():
     return CoralAppData.rootNode
 
 def findNode(fullName):
-    names = fullName.split(".")
-    firstName = names.pop(0)
+    node = findObject(fullName)
+    if isinstance(node, _coral.Node):
+        return node
     
-    node = None
-    if firstName == rootNode().name():
-        node = rootNode()
-        for name in names:
-            node = node.findNode(name)
-        
-            if node is None:
-                break
-    
-    return node
+    return None
 
 def findAttribute(fullName):
-    names = fullName.split(".")
-    attrName = names.pop(-1)
+    attribute = findObject(fullName)
+    if isinstance(attribute, _coral.Attribute):
+        return attribute
     
-    fullNodeName = ".".join(names)
-    node = findNode(fullNodeName)
-    
-    attribute = None
-    if node:
-        attribute = node.findAttribute(attrName)
-    
-    return attribute
+    return None
 
 def findObject(fullName):
-    names = fullName.split(".")
-    rootName = names.pop(0)
-
+    names = fullName.split(".", 1)
+    
     object = None
     root = rootNode()
-    if rootName == root.name():
+    if names[0] == root.name():
         object = root
-        for name in names:
-            object = object.findObject(name)
-            
-            if object is None:
-                break
+        if len(names) > 1:
+            object = root.findObjectByPath(names[1])
     
     return object
 
@@ -677,6 +659,21 @@ def findAttributeClass(className):
     
     return attrClass
 
+def beginBatchEdit():
+    """Starts a batch of edits, see NetworkManager.beginBatchEdit, every call must be matched by endBatchEdit.
+    """
+    _coral.NetworkManager.beginBatchEdit()
+
+def endBatchEdit():
+    """Ends a batch of edits started by beginBatchEdit.
+    Once the outermost batch is over, the connections whose specializations turned out not to match are logged as errors.
+    """
+    _coral.NetworkManager.endBatchEdit()
+    
+    if not _coral.NetworkManager.isBatchEditing():
+        for attribute in _coral.NetworkManager.failedBatchConnections():
+            logError("specializations don't match: " + attribute.input().fullName() + " -> " + attribute.fullName())
+
 def collapseNodes(nodes, collapsedNode = None):
     import collapser
     
@@ -685,7 +682,12 @@ def collapseNodes(nodes, collapsedNode = None):
             logError("invalid collapsedNode passed as argument")
             return None
         
-    collapsedNode = collapser.collapseNodes(nodes, collapsedNode)
+    beginBatchEdit()
+    try:
+        collapsedNode = collapser.collapseNodes(nodes, collapsedNode)
+    finally:
+        endBatchEdit()
+    
     _notifyCollapsedNodeObservers(collapsedNode)
     
     return collapsedNode
@@ -693,8 +695,12 @@ def collapseNodes(nodes, collapsedNode = None):
 def explodeCollapsedNode(collapsedNode):
     import collapser
     
-    extractedNodes = collapser.explodeCollapsedNode(collapsedNode)
-    collapsedNode.deleteIt()
+    beginBatchEdit()
+    try:
+        extractedNodes = collapser.explodeCollapsedNode(collapsedNode)
+        collapsedNode.deleteIt()
+    finally:
+        endBatchEdit()
     
     return extractedNodes
     
@@ -814,8 +820,12 @@ def _loadNetworkScript(networkScript, topNode = ""):
         return;
     
     CoralAppData.loadingNetwork = True
-    networkScriptData["runScript"](topNode)
-    CoralAppData.loadingNetwork = False
+    beginBatchEdit()
+    try:
+        networkScriptData["runScript"](topNode)
+    finally:
+        endBatchEdit()
+        CoralAppData.loadingNetwork = False
     
     _notifyNetworkLoadedObservers(topNode)
 
@@ -967,10 +977,37 @@ def importCollapsedNodeFile(filename, topNode):
                 logError("not a CollapsedNode file")
                 return
             
-        saveScriptData["runScript"](topNode = topNode.fullName())
+        beginBatchEdit()
+        try:
+            saveScriptData["runScript"](topNode = topNode.fullName())
+        finally:
+            endBatchEdit()
     
         if CoralAppData.shouldLogInfos:
             logInfo("loaded netowrk file: " + filename)
 
 def connectAttributes(sourceAttribute, destinationAttribute):
     _coral.NetworkManager.connect(sourceAttribute, destinationAttribute)
+
+def evaluateTimeSamples(timeAttribute, samples, outputs):
+    """Generator evaluating outputs for each time sample, to bake caches or compute motion blur subframes.
+    timeAttribute is usually the time output of a Time node, it gets restored once all the samples are evaluated.
+    The samples are evaluated concurrently, each on its own copy of the values, when the network allows it (see TimeSampler.evaluate), 
+    networks keeping a state such as simulations are evaluated one sample after the other.
+    Yields the sample being evaluated once the values of outputs are ready to be read, example:
+    for sample in coralApp.evaluateTimeSamples(timeNode.findObject("time"), [1.0, 1.25, 1.5], [geoAttr]):
+        cache.write(sample, geoAttr.value())
+    """
+    samples = list(samples)
+    
+    sampler = _coral.TimeSampler(timeAttribute)
+    sampler.setSamples(samples)
+    for output in outputs:
+        sampler.addOutput(output)
+    
+    try:
+        sampler.evaluate()
+        while sampler.next():
+            yield samples[sampler.currentSample()]
+    finally:
+        sampler.reset()
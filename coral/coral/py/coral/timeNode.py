@@ -19,6 +19,7 @@ class TimeNode(Node):
         self._setAttributeAllowedSpecializations(self._time, ["Float"])
                 
         self._setUpdateEnabled(False)
+        self._setAttributeIsAnimated(self._time, True)
         
         self._framesPerSecond.outValue().setFloatValueAt(0, 24.0)
         
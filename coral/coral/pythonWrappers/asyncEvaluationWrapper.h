@@ -0,0 +1,116 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+
+#ifndef ASYNCEVALUATIONWRAPPER_H
+#define ASYNCEVALUATIONWRAPPER_H
+
+#include <boost/shared_ptr.hpp>
+#include <boost/python.hpp>
+
+#include "../src/AsyncEvaluation.h"
+#include "../src/Attribute.h"
+#include "../src/Node.h"
+#include "../src/PythonDataCollector.h"
+#include "../src/pythonWrapperUtils.h"
+
+using namespace coral;
+
+bool asyncEvaluation_holdsGIL(){
+	#if PY_VERSION_HEX >= 0x03040000
+		return PyGILState_Check();
+	#else
+		PyThreadState *state = PyGILState_GetThisThreadState();
+		return state && state == _PyThreadState_Current;
+	#endif
+}
+
+// The nodes updated by the worker thread may need the GIL to run their python code, 
+// it's released while a thread holding it waits for them, whatever call led to the wait.
+void *asyncEvaluation_waitStartedCallback(){
+	if(pythonWrapperUtils::pyGILEnsured || !asyncEvaluation_holdsGIL()){
+		return 0;
+	}
+	
+	return PyEval_SaveThread();
+}
+
+void asyncEvaluation_waitEndedCallback(void *data){
+	if(data){
+		PyEval_RestoreThread((PyThreadState*)data);
+	}
+}
+
+boost::shared_ptr<AsyncEvaluation> asyncEvaluation_start(Attribute *attribute){
+	PyThreadState *state = 0;
+	if(!pythonWrapperUtils::pyGILEnsured){
+		state = PyEval_SaveThread();
+	}
+	
+	boost::shared_ptr<AsyncEvaluation> evaluation = AsyncEvaluation::start(attribute);
+	
+	if(state){
+		PyEval_RestoreThread(state);
+	}
+	
+	return evaluation;
+}
+
+boost::python::object asyncEvaluation_attribute(AsyncEvaluation &self){
+	return PythonDataCollector::findPyObject(self.attribute()->id());
+}
+
+boost::python::object asyncEvaluation_lastUpdatedNode(AsyncEvaluation &self){
+	boost::python::object nodeObj;
+	
+	Node *node = self.lastUpdatedNode();
+	if(node){
+		nodeObj = PythonDataCollector::findPyObject(node->id());
+	}
+	
+	return nodeObj;
+}
+
+void asyncEvaluationWrapper(){
+	boost::python::class_<AsyncEvaluation, boost::shared_ptr<AsyncEvaluation>, boost::noncopyable>("AsyncEvaluation", boost::python::no_init)
+		.def("attribute", asyncEvaluation_attribute)
+		.def("isDone", &AsyncEvaluation::isDone)
+		.def("isCancelled", &AsyncEvaluation::isCancelled)
+		.def("cancel", &AsyncEvaluation::cancel)
+		.def("wait", &AsyncEvaluation::wait)
+		.def("updatesDone", &AsyncEvaluation::updatesDone)
+		.def("updatesPlanned", &AsyncEvaluation::updatesPlanned)
+		.def("progress", &AsyncEvaluation::progress)
+		.def("lastUpdatedNode", asyncEvaluation_lastUpdatedNode)
+	;
+	
+	AsyncEvaluation::_waitStartedCallback = asyncEvaluation_waitStartedCallback;
+	AsyncEvaluation::_waitEndedCallback = asyncEvaluation_waitEndedCallback;
+}
+
+#endif
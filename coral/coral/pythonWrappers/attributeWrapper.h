@@ -37,6 +37,7 @@
 #include "../src/AttributeAccessor.h"
 #include "../src/ObjectAccessor.h"
 #include "../src/pythonWrapperUtils.h"
+#include "asyncEvaluationWrapper.h"
 
 class AttributeWrapper: public Attribute, public boost::python::wrapper<Attribute>{
 public:
@@ -103,6 +104,10 @@ boost::python::object attribute_value(Attribute &self){
 	return valueObj;
 }
 
+boost::shared_ptr<AsyncEvaluation> attribute_requestValueAsync(Attribute &self){
+	return asyncEvaluation_start(&self);
+}
+
 boost::python::object attributeoutValue(Attribute &self){
 	boost::python::object valueObj;
 	
@@ -205,6 +210,7 @@ void attributeWrapper(){
 		.def("parent", attribute_parent)
 		.def("outputs", attribute_outputs)
 		.def("value", attribute_value)
+		.def("requestValueAsync", attribute_requestValueAsync)
 		.def("deleteIt", &Attribute::deleteIt)
 		.def("isOutput", &Attribute::isOutput)
 		.def("isInput", &Attribute::isInput)
@@ -226,6 +232,12 @@ void attributeWrapper(){
 		.def("forceSpecializationUpdate", &Attribute::forceSpecializationUpdate)
 		.def("specializationOverride", &Attribute::specializationOverride)
 		.def("forceDirty", &Attribute::forceDirty)
+		.def("isAnimated", &Attribute::isAnimated)
+		.def("isLazy", &Attribute::isLazy)
+		.def("dirtyCount", &Attribute::dirtyCount)
+		.def("computeCount", &Attribute::computeCount)
+		.def("valueBytes", &Attribute::valueBytes)
+		.def("resetCounters", &Attribute::resetCounters)
 		.def("connectedNonPassThrough", &attribute_connectedNonPassThrough)
 		.def("shortDebugInfo", &Attribute::shortDebugInfo)
 		;
@@ -56,6 +56,17 @@ boost::python::object nestedObject_findObject(NestedObject &self, const std::str
 	return pyObject;
 }
 
+boost::python::object nestedObject_findObjectByPath(NestedObject &self, const std::string &path){
+	NestedObject *object = self.findObjectByPath(path);
+	boost::python::object pyObject;
+	
+	if(object){
+		pyObject = PythonDataCollector::findPyObject(object->id());
+	}
+	
+	return pyObject;
+}
+
 void nestedObjectWrapper(){
 	boost::python::class_<NestedObject, boost::shared_ptr<NestedObject>, boost::python::bases<Object>, boost::noncopyable>("NestedObject", boost::python::init<const std::string &, NestedObject *>())
 		.def("__init__", pythonWrapperUtils::__init__<NestedObject, const std::string, NestedObject*>)
@@ -66,6 +77,7 @@ void nestedObjectWrapper(){
 		.def("classNames", &NestedObject::classNames)
 		.def("hasClassName", &NestedObject::hasClassName)
 		.def("findObject", nestedObject_findObject)
+		.def("findObjectByPath", nestedObject_findObjectByPath)
 		.def("fullName", &NestedObject::fullName)
 		.def("objects", &NestedObject::objects)
 		.def("createUnwrapped", pythonWrapperUtils::createUnwrapped2<NestedObject, const std::string, Node*>)
@@ -40,6 +40,13 @@ boost::python::object nodeManager_findObjectById(int id){
 	return PythonDataCollector::findPyObject(id);
 }
 
+std::vector<Attribute*> networkManager_staticAttributes(Node *node){
+	std::vector<Attribute*> staticAttributes;
+	NetworkManager::getStaticAttributes(node, staticAttributes);
+	
+	return staticAttributes;
+}
+
 void networkManagerWrapper(){
 	boost::python::class_<NetworkManager>("NetworkManager")
 		.def("objectCount", &NetworkManager::objectCount)
@@ -52,12 +59,26 @@ void networkManagerWrapper(){
 		.staticmethod("connect")
 		.def("isCycle", &NetworkManager::isCycle)
 		.staticmethod("isCycle")
+		.def("staticAttributes", networkManager_staticAttributes)
+		.staticmethod("staticAttributes")
 		.def("resolveFilename", &NetworkManager::resolveFilename)
 		.staticmethod("resolveFilename")
 		.def("addSearchPath", &NetworkManager::addSearchPath)
 		.staticmethod("addSearchPath")
 		.def("removeSearchPath", &NetworkManager::removeSearchPath)
 		.staticmethod("removeSearchPath")
+		.def("beginBatchEdit", &NetworkManager::beginBatchEdit)
+		.staticmethod("beginBatchEdit")
+		.def("endBatchEdit", &NetworkManager::endBatchEdit)
+		.staticmethod("endBatchEdit")
+		.def("isBatchEditing", &NetworkManager::isBatchEditing)
+		.staticmethod("isBatchEditing")
+		.def("failedBatchConnections", &NetworkManager::failedBatchConnections)
+		.staticmethod("failedBatchConnections")
+		.def("setEarlyCutoff", &NetworkManager::setEarlyCutoff)
+		.staticmethod("setEarlyCutoff")
+		.def("earlyCutoff", &NetworkManager::earlyCutoff)
+		.staticmethod("earlyCutoff")
 	;
 }
 
@@ -49,6 +49,8 @@ using namespace coral;
 class NodeWrapper: public Node, public boost::python::wrapper<Node>{
 public:
 	NodeWrapper(const std::string &name, Node *parent): Node(name, parent){
+		// python nodes can hold any state and need the GIL, time samples reaching them are evaluated in sequence
+		setKeepsState(true);
 	}
 	
 	void setName(const std::string &name){
@@ -365,10 +367,18 @@ void node_catchAttributeDirtied(Node &self, Attribute *attribute, bool value){
 	NodeAccessor::_catchAttributeDirtied(self, attribute, value);
 }
 
+void node_setAttributeIsAnimated(Node &self, Attribute *attribute, bool value){
+	NodeAccessor::_setAttributeIsAnimated(self, attribute, value);
+}
+
 void node_setSliceable(Node &self, bool value){
 	NodeAccessor::_setSliceable(self, value);
 }
 
+void node_setKeepsState(Node &self, bool value){
+	NodeAccessor::_setKeepsState(self, value);
+}
+
 std::vector<Attribute*> node_dynamicAttributes(Node &self){
 	return self.dynamicAttributes();
 }
@@ -444,6 +454,12 @@ void nodeWrapper(){
 		.def("computeTimeTicks", &Node::computeTimeTicks)
 		.def("computeTimeMilliseconds", &Node::computeTimeMilliseconds)
 		.def("computeTimeSeconds", &Node::computeTimeSeconds)
+		.def("updateCount", &Node::updateCount)
+		.def("totalUpdateTime", &Node::totalUpdateTime)
+		.def("maxUpdateTime", &Node::maxUpdateTime)
+		.def("updatedSlices", &Node::updatedSlices)
+		.def("outputBytes", &Node::outputBytes)
+		.def("resetCounters", &Node::resetCounters)
 		.def("addDynamicAttribute", &Node::addDynamicAttribute, &NodeWrapper::addDynamicAttribute_default)
 		.def("dynamicAttributes", node_dynamicAttributes)
 		.def("_setAllowDynamicAttributes", node_setAllowDynamicAttributes)
@@ -455,10 +471,12 @@ void nodeWrapper(){
 		.def("enableSpecializationPreset", &Node::enableSpecializationPreset)
 		.def("enabledSpecializationPreset", &Node::enabledSpecializationPreset)
 		.def("_catchAttributeDirtied", node_catchAttributeDirtied)
+		.def("_setAttributeIsAnimated", node_setAttributeIsAnimated)
 		.def("attributeDirtied", &Node::attributeDirtied, &NodeWrapper::attributeDirtied_default)
 		.def("attributeSpecializationPreset", &Node::attributeSpecializationPreset)
 		.def("sliceable", &Node::sliceable)
 		.def("_setSliceable", node_setSliceable)
+		.def("_setKeepsState", node_setKeepsState)
 		.def("slicer", &node_slicer)
 		.def("shortDebugInfo", &Node::shortDebugInfo, &NodeWrapper::shortDebugInfo_default)
 	;
@@ -98,23 +98,23 @@ int numeric_type(Numeric &self){
 }
 
 std::vector<Imath::V3f> numeric_vec3Values(Numeric &self){
-	return self.vec3Values();
+	return self.vec3Values().toVector();
 }
 
 std::vector<Imath::Color4f> numeric_col4Values(Numeric &self){
-	return self.col4Values();
+	return self.col4Values().toVector();
 }
 
 std::vector<Imath::Quatf> numeric_quatValues(Numeric &self){
-	return self.quatValues();
+	return self.quatValues().toVector();
 }
 
 std::vector<Imath::M44f> numeric_matrix44Values(Numeric &self){
-	return self.matrix44Values();
+	return self.matrix44Values().toVector();
 }
 
 std::vector<float> numeric_floatValues(Numeric &self){
-	return self.floatValues();
+	return self.floatValues().toVector();
 }
 
 void numeric_setFloatValues(Numeric &self, boost::python::list pyList){
@@ -128,7 +128,7 @@ void numeric_setFloatValues(Numeric &self, boost::python::list pyList){
 }
 
 std::vector<int> numeric_intValues(Numeric &self){
-	return self.intValues();
+	return self.intValues().toVector();
 }
 
 void numericNodesWrapper(){
@@ -183,7 +183,9 @@ void numericNodesWrapper(){
 		.staticmethod("createUnwrapped")
 	;
 	
-	pythonWrapperUtils::pythonWrapper<NumericAttribute, Attribute>("NumericAttribute");
+	pythonWrapperUtils::pythonWrapper<NumericAttribute, Attribute>("NumericAttribute")
+		.def("setMappedStorage", &NumericAttribute::setMappedStorage)
+		.def("mappedStorage", &NumericAttribute::mappedStorage);
 	pythonWrapperUtils::pythonWrapper<IntNode, Node>("IntNode");
 	pythonWrapperUtils::pythonWrapper<FloatNode, Node>("FloatNode");
 	pythonWrapperUtils::pythonWrapper<ArithmeticNode, Node>("ArithmeticNode");
@@ -207,6 +209,7 @@ void numericNodesWrapper(){
 	pythonWrapperUtils::pythonWrapper<BuildArray, Node>("BuildArray")
 		.def("addNumericAttribute", &BuildArray::addNumericAttribute);
 	pythonWrapperUtils::pythonWrapper<RangeArray, Node>("RangeArray");
+	pythonWrapperUtils::pythonWrapper<MappedArray, Node>("MappedArray");
 	pythonWrapperUtils::pythonWrapper<Matrix44Translation, Node>("Matrix44Translation");
 	pythonWrapperUtils::pythonWrapper<Matrix44RotationAxis, Node>("Matrix44RotationAxis");
 	pythonWrapperUtils::pythonWrapper<Matrix44FromVectors, Node>("Matrix44FromVectors");
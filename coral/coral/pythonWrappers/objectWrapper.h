@@ -38,6 +38,11 @@
 #include "../src/pythonWrapperUtils.h"
 
 void object_addReferenceCallback(Object *object){
+	if(object->id() == 0){
+		// out of ids, see Object::id(), the object stays with its c++ owner
+		return;
+	}
+	
 	boost::python::object pyObject = PythonDataCollector::findPyObject(object->id());
 	
 	if(!pyObject){
@@ -53,6 +58,10 @@ void object_addReferenceCallback(Object *object){
 }
 
 void object_removeReferenceCallback(Object *object){
+	if(object->id() == 0){
+		return;
+	}
+	
 	PyObject *pyObj = PythonDataCollector::findPyObjectPtr(object->id());
 	
 	if(pyObj){
@@ -63,6 +63,10 @@
 #include "enumWrapper.h"
 #include "processSimulationNodeWrapper.h"
 #include "deformerNodesWrapper.h"
+#include "timeSamplerWrapper.h"
+#include "profilerWrapper.h"
+#include "compiledNetworkWrapper.h"
+#include "asyncEvaluationWrapper.h"
 #include "../builtinNodes/KdNodes.h"
 
 using namespace coral;
@@ -121,6 +125,10 @@ BOOST_PYTHON_MODULE(_coral)
 	enumWrapper();
 	processSimulationNodeWrapper();
 	deformerNodesWrapper();
+	timeSamplerWrapper();
+	profilerWrapper();
+	compiledNetworkWrapper();
+	asyncEvaluationWrapper();
 	pythonWrapperUtils::pythonWrapper<FindPointsInRange, Node>("FindPointsInRange");
 	
 	boost::python::to_python_converter<std::vector<std::string>, pythonWrapperUtils::stdVectorToPythonList<std::string> >();
@@ -0,0 +1,71 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+#ifndef TIMESAMPLERWRAPPER_H
+#define TIMESAMPLERWRAPPER_H
+
+#include <boost/python.hpp>
+
+#include "../src/TimeSampler.h"
+#include "../src/NumericAttribute.h"
+
+using namespace coral;
+
+void timeSampler_setSamples(TimeSampler &self, boost::python::list samples){
+	std::vector<float> samplesVector;
+	for(int i = 0; i < boost::python::len(samples); ++i){
+		samplesVector.push_back(boost::python::extract<float>(samples[i]));
+	}
+	
+	self.setSamples(samplesVector);
+}
+
+boost::python::list timeSampler_samples(TimeSampler &self){
+	boost::python::list samples;
+	
+	const std::vector<float> &samplesVector = self.samples();
+	for(int i = 0; i < samplesVector.size(); ++i){
+		samples.append(samplesVector[i]);
+	}
+	
+	return samples;
+}
+
+void timeSamplerWrapper(){
+	boost::python::class_<TimeSampler, boost::noncopyable>("TimeSampler", boost::python::init<NumericAttribute*>())
+		.def("setSamples", timeSampler_setSamples)
+		.def("samples", timeSampler_samples)
+		.def("addOutput", &TimeSampler::addOutput)
+		.def("evaluate", &TimeSampler::evaluate)
+		.def("next", &TimeSampler::next)
+		.def("currentSample", &TimeSampler::currentSample)
+		.def("reset", &TimeSampler::reset)
+	;
+}
+
+#endif
@@ -0,0 +1,280 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+#include <vector>
+
+#ifdef CORAL_PARALLEL_TBB
+	#include <tbb/tbb_thread.h>
+	#include "coreParallelAlgos.h"
+#endif
+
+#include "AsyncEvaluation.h"
+#include "Attribute.h"
+#include "Node.h"
+#include "EvaluationPlan.h"
+#include "EvaluationContext.h"
+#include "NetworkManager.h"
+
+using namespace coral;
+
+void*(*AsyncEvaluation::_waitStartedCallback)() = 0;
+void(*AsyncEvaluation::_waitEndedCallback)(void *data) = 0;
+
+AsyncEvaluation::AsyncEvaluation(Attribute *attribute):
+	_attribute(attribute),
+	_updatesDone(0),
+	_updatesPlanned(0),
+	_lastUpdatedNodeId(0){
+	_done = false;
+	_cancelled = false;
+}
+
+boost::shared_ptr<AsyncEvaluation> AsyncEvaluation::start(Attribute *attribute){
+	boost::shared_ptr<AsyncEvaluation> evaluation(new AsyncEvaluation(attribute));
+	
+	// a newer request supersedes the one in progress
+	cancelPending(attribute);
+	
+	if(attribute->isClean()){
+		evaluation->_done = true;
+		return evaluation;
+	}
+	
+	if(!attribute->_evaluationPlan){
+		EvaluationPlan::build(attribute);
+	}
+	
+	evaluation->_plan = attribute->_evaluationPlan;
+	
+	#ifdef CORAL_PARALLEL_TBB
+		EvaluationContext *context = evaluation->_plan->context();
+		
+		// requested by a node while updating or during a batch edit, plans can't be trusted from another thread then
+		if(!context->isEvaluating() && !NetworkManager::isBatchEditing()){
+			{
+				tbb::mutex::scoped_lock lock(context->_asyncMutex);
+				context->_asyncEvaluation = evaluation;
+				context->_asyncRequester = tbb::this_tbb_thread::get_id();
+				context->_cancelled = false;
+				context->_updatesPlanned = 0;
+				context->_updatesDone = 0;
+				context->_lastUpdatedNodeId = 0;
+				context->_asyncEvaluating = true;
+			}
+			
+			// from now on the group reads as being evaluated, so that no other evaluation starts on it before the worker does
+			context->setIsEvaluating(true);
+			
+			asyncEvaluation_worker worker(evaluation);
+			tbb::tbb_thread thread(worker);
+			thread.detach();
+			
+			return evaluation;
+		}
+	#endif
+	
+	attribute->clean();
+	evaluation->finish();
+	
+	return evaluation;
+}
+
+void AsyncEvaluation::run(){
+	#ifdef CORAL_PARALLEL_TBB
+		EvaluationContext *context = _plan->context();
+		if(!context->isCancelled() && !_attribute->isClean()){
+			Attribute::cleanGroup(std::vector<Attribute*>(1, _attribute));
+		}
+		else{
+			context->setIsEvaluating(false);
+		}
+	#endif
+	
+	finish();
+}
+
+void AsyncEvaluation::finish(){
+	#ifdef CORAL_PARALLEL_TBB
+		if(_plan){
+			EvaluationContext *context = _plan->context();
+			
+			tbb::mutex::scoped_lock lock(context->_asyncMutex);
+			if(context->_asyncEvaluation.get() == this){
+				_updatesPlanned = context->_updatesPlanned;
+				_updatesDone = context->_updatesDone;
+				_lastUpdatedNodeId = context->_lastUpdatedNodeId;
+				
+				context->_asyncEvaluating = false;
+				context->_cancelled = false;
+				context->_asyncEvaluation.reset();
+			}
+		}
+		
+		tbb::interface5::unique_lock<tbb::mutex> lock(_doneMutex);
+		_done = true;
+		_doneCondition.notify_all();
+	#else
+		_done = true;
+	#endif
+}
+
+boost::shared_ptr<AsyncEvaluation> AsyncEvaluation::pending(Attribute *attribute){
+	boost::shared_ptr<AsyncEvaluation> evaluation;
+	
+	#ifdef CORAL_PARALLEL_TBB
+		if(attribute->_evaluationPlan){
+			EvaluationContext *context = attribute->_evaluationPlan->context();
+			if(context->_asyncEvaluating){
+				tbb::mutex::scoped_lock lock(context->_asyncMutex);
+				if(context->_asyncEvaluation && context->_asyncRequester == tbb::this_tbb_thread::get_id()){
+					evaluation = context->_asyncEvaluation;
+				}
+			}
+		}
+	#endif
+	
+	return evaluation;
+}
+
+void AsyncEvaluation::cancelPending(Attribute *attribute){
+	boost::shared_ptr<AsyncEvaluation> evaluation = pending(attribute);
+	if(evaluation){
+		evaluation->cancel();
+	}
+}
+
+void AsyncEvaluation::waitPending(Attribute *attribute){
+	boost::shared_ptr<AsyncEvaluation> evaluation = pending(attribute);
+	if(evaluation){
+		evaluation->wait();
+	}
+}
+
+Attribute *AsyncEvaluation::attribute(){
+	return _attribute;
+}
+
+bool AsyncEvaluation::isDone(){
+	return _done;
+}
+
+bool AsyncEvaluation::isCancelled(){
+	return _cancelled;
+}
+
+void AsyncEvaluation::cancel(){
+	if(!_done){
+		_cancelled = true;
+		
+		#ifdef CORAL_PARALLEL_TBB
+			EvaluationContext *context = _plan->context();
+			
+			tbb::mutex::scoped_lock lock(context->_asyncMutex);
+			if(context->_asyncEvaluation.get() == this){
+				context->_cancelled = true;
+			}
+		#endif
+	}
+	
+	wait();
+}
+
+// Waits can be reached from any edit of the network, the callbacks let the python bindings release the GIL 
+// for the python nodes running on the worker thread whatever the entry point was.
+void AsyncEvaluation::wait(){
+	#ifdef CORAL_PARALLEL_TBB
+		if(_done){
+			return;
+		}
+		
+		void *waitData = 0;
+		if(_waitStartedCallback){
+			waitData = _waitStartedCallback();
+		}
+		
+		{
+			tbb::interface5::unique_lock<tbb::mutex> lock(_doneMutex);
+			while(!_done){
+				_doneCondition.wait(lock);
+			}
+		}
+		
+		if(_waitEndedCallback){
+			_waitEndedCallback(waitData);
+		}
+	#endif
+}
+
+int AsyncEvaluation::updatesDone(){
+	#ifdef CORAL_PARALLEL_TBB
+		if(!_done){
+			return _plan->context()->_updatesDone;
+		}
+	#endif
+	
+	return _updatesDone;
+}
+
+int AsyncEvaluation::updatesPlanned(){
+	#ifdef CORAL_PARALLEL_TBB
+		if(!_done){
+			return _plan->context()->_updatesPlanned;
+		}
+	#endif
+	
+	return _updatesPlanned;
+}
+
+float AsyncEvaluation::progress(){
+	if(_done){
+		return 1.0;
+	}
+	
+	int planned = updatesPlanned();
+	if(planned == 0){
+		return 0.0;
+	}
+	
+	return float(updatesDone()) / float(planned);
+}
+
+Node *AsyncEvaluation::lastUpdatedNode(){
+	int nodeId = _lastUpdatedNodeId;
+	
+	#ifdef CORAL_PARALLEL_TBB
+		if(!_done){
+			nodeId = _plan->context()->_lastUpdatedNodeId;
+		}
+	#endif
+	
+	if(nodeId){
+		return (Node*)NetworkManager::findObjectById(nodeId);
+	}
+	
+	return 0;
+}
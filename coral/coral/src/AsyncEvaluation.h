@@ -0,0 +1,121 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+
+#ifndef CORAL_ASYNCEVALUATION_H
+#define CORAL_ASYNCEVALUATION_H
+
+#include <boost/shared_ptr.hpp>
+#include "coralDefinitions.h"
+
+#ifdef CORAL_PARALLEL_TBB
+	#include <tbb/atomic.h>
+	#include <tbb/mutex.h>
+	#include <tbb/compat/condition_variable>
+#endif
+
+namespace coral{
+class Attribute;
+class Node;
+class EvaluationPlan;
+class asyncEvaluation_worker;
+
+//! The evaluation of an attribute running in the background, see Attribute::requestValueAsync().
+//
+//! The network of the attribute is cleaned on a worker thread while the thread that requested it goes on. 
+//! The worker writes the values of the network in place: they can't be read, outValue() included, until the evaluation is done, 
+//! value() and wait() block until then.
+//! A newer edit supersedes the evaluation in progress: dirtying, connecting or deleting an attribute of the same network 
+//! from the thread that requested the evaluation cancels it and waits for it to stop. 
+//! Cancellation is cooperative, it's checked before each node update and between slices: 
+//! outputs left half computed stay dirty, the ones computed already keep their new value.
+//! Progress is counted in node updates.
+//! Without CORAL_PARALLEL_TBB the attribute is cleaned by requestValueAsync() itself, the evaluation returned is done already.
+class CORAL_EXPORT AsyncEvaluation{
+public:
+	//! Starts cleaning attribute in the background, the evaluation already running on its network, if any, is cancelled first.
+	static boost::shared_ptr<AsyncEvaluation> start(Attribute *attribute);
+	
+	//! Cancels the evaluation running on the network of attribute, if any, and waits for it to stop.
+	//! Only the thread that started the evaluation is concerned, calls coming from the nodes being updated do nothing.
+	static void cancelPending(Attribute *attribute);
+	
+	//! Waits for the evaluation running on the network of attribute, if any, same as cancelPending() only the thread that started it waits.
+	static void waitPending(Attribute *attribute);
+	
+	Attribute *attribute();
+	bool isDone();
+	bool isCancelled();
+	
+	//! Asks the evaluation to stop and waits for it.
+	void cancel();
+	void wait();
+	
+	int updatesDone();
+	int updatesPlanned();
+	
+	//! The fraction of the node updates planned so far that are done, lazy inputs read by the nodes may still add some.
+	float progress();
+	
+	//! The node updated last, 0 until the first update is done.
+	Node *lastUpdatedNode();
+	
+	// external waiting stuff, invoked around each wait on the worker thread, see wait()
+	static void*(*_waitStartedCallback)();
+	static void(*_waitEndedCallback)(void *data);
+
+private:
+	friend class asyncEvaluation_worker;
+	
+	Attribute *_attribute;
+	boost::shared_ptr<EvaluationPlan> _plan;
+	int _updatesDone;
+	int _updatesPlanned;
+	int _lastUpdatedNodeId;
+	
+	#ifdef CORAL_PARALLEL_TBB
+		tbb::atomic<bool> _done;
+		tbb::atomic<bool> _cancelled;
+		tbb::mutex _doneMutex;
+		tbb::interface5::condition_variable _doneCondition;
+	#else
+		bool _done;
+		bool _cancelled;
+	#endif
+	
+	AsyncEvaluation(Attribute *attribute);
+	AsyncEvaluation(const AsyncEvaluation &other);
+	AsyncEvaluation &operator =(const AsyncEvaluation &other);
+	void run();
+	void finish();
+	static boost::shared_ptr<AsyncEvaluation> pending(Attribute *attribute);
+};
+
+}
+
+#endif
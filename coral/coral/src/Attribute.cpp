@@ -27,8 +27,11 @@
 // </license>
 
 #ifdef CORAL_PARALLEL_TBB
+	#include <tbb/parallel_do.h>
 	#include <tbb/parallel_for.h>
-	#include <tbb/mutex.h>
+	#include <tbb/blocked_range.h>
+	#include <tbb/atomic.h>
+	#include <tbb/recursive_mutex.h>
 	#include "coreParallelAlgos.h"
 #endif
 
@@ -36,12 +39,19 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <algorithm>
 #include <assert.h>
 
 #include "Attribute.h"
 #include "Node.h"
 #include "NetworkManager.h"
 #include "Value.h"
+#include "EvaluationPlan.h"
+#include "EvaluationContext.h"
+#include "Profiler.h"
+#include "SpecializationSolver.h"
+#include "AsyncEvaluation.h"
+#include "TimeSampler.h"
 #include "containerUtils.h"
 #include "Command.h"
 #include "ErrorObject.h"
@@ -55,42 +65,56 @@ void(*Attribute::_disconnectOutputCallback)(Attribute *self, Attribute *other) =
 void(*Attribute::_deleteItCallback)(Attribute *self) = 0;
 void(*Attribute::_specializationCallBack)(Attribute *self) = 0;
 
-std::vector<void(*)(Attribute *)> _dirtyingDoneCallbackQueue;
-bool _cleaningLocked = false;
-
-namespace {
-	std::vector<std::string> intersectedSpecialization(const std::vector<std::string> &specialization1, const std::vector<std::string> &specialization2){
-		std::vector<std::string> newSpecialization;
-	
-		for(int i = 0; i < specialization1.size(); ++i){
-			if(containerUtils::elementInContainer(specialization1[i], specialization2)){
-				newSpecialization.push_back(specialization1[i]);
-			}
+// Dirty state is kept as two epochs per attribute, compared against this counter which grows with each dirty and clean pass.
+// An attribute is clean when _cleanEpoch > _dirtyEpoch. When _dirtyEpoch > _cleanEpoch the attribute is dirty and no clean pass 
+// has seen it since, so everything downstream of it is dirty too and propagation can stop there. 
+// When the two are equal the attribute was left dirty by a clean pass, its node refused to compute it or its input is dirty, 
+// and what's downstream of it may have been cleaned meanwhile.
+// Epochs and visit stamps are compared across networks once they get connected, the counters are shared by all the evaluation contexts.
+#ifdef CORAL_PARALLEL_TBB
+	namespace {
+		tbb::atomic<unsigned int> initialCount(unsigned int value){
+			tbb::atomic<unsigned int> count;
+			count = value;
+			
+			return count;
 		}
-	
-		return newSpecialization;
 	}
+	
+	tbb::atomic<unsigned int> _evaluationEpoch = initialCount(1);
+	tbb::atomic<unsigned int> _lastVisitStamp = initialCount(0);
+#else
+	unsigned int _evaluationEpoch = 1;
+	unsigned int _lastVisitStamp = 0;
+#endif
 
-	#ifdef CORAL_PARALLEL_TBB
-		tbb::mutex _globalMutex;
-	#endif
-}
+// context of the attributes that are not part of any plan yet
+EvaluationContext _defaultEvaluationContext;
 
 Attribute::Attribute(const std::string &name, Node *parent):
 	NestedObject(name, parent),
 	_value(0),
 	_inputValue(0),
 	_input(0),
-	_isClean(false),
 	_isOutput(false),
 	_isInput(false),
 	_passThrough(false),
 	// _valueObserved(0),
 	_computeTimeSeconds(0),
 	_computeTimeMilliseconds(0),
-	_notifyParentNodeOnDirty(false){
-		
-	_dirtyChain.push_back(this);
+	_notifyParentNodeOnDirty(false),
+	_isLazy(false),
+	_isAnimatedSource(false),
+	_planIndex(0),
+	_visitStamp(0),
+	_dirtyEpoch(1),
+	_cleanEpoch(0),
+	_changedEpoch(1),
+	_computedEpoch(0),
+	_contentHash(0),
+	_hasContentHash(false),
+	_dirtyCount(0),
+	_computeCount(0){
 }
 
 Attribute::~Attribute(){
@@ -124,13 +148,22 @@ void Attribute::removeAffectFrom(Attribute *attribute){
 
 void Attribute::removeAffect(Attribute *attribute){
 	if(containerUtils::elementInContainer(attribute, _affect)){
+		AsyncEvaluation::cancelPending(this);
+		AsyncEvaluation::cancelPending(attribute);
+		
 		containerUtils::eraseElementInContainer(attribute, _affect);
 		
 		if(attribute->isAffectedBy(this)){
 			attribute->removeAffectFrom(this);
 		}
 		
-		NetworkManager::removeEdge(this, attribute);
+		if(!isDeleted()){
+			cacheEvaluationChain();
+		}
+		
+		if(!attribute->isDeleted()){
+			attribute->cacheEvaluationChain();
+		}
 	}
 }
 
@@ -155,7 +188,7 @@ void Attribute::resetInputValuesInChain(){
 
 void Attribute::disconnectInput(){
 	if(_input){
-		NetworkManager::removeEdge(_input, this);
+		AsyncEvaluation::cancelPending(this);
 		
 		Attribute *oldInput = _input;
 		_input = 0;
@@ -191,6 +224,8 @@ void Attribute::disconnectInput(){
 
 void Attribute::disconnectOutput(Attribute *attribute){
 	if(this->isConnectedTo(attribute)){		
+		AsyncEvaluation::cancelPending(this);
+		
 		containerUtils::eraseElementInContainer(attribute, _outputs);
 		
 		if(attribute->input() == this){
@@ -215,11 +250,22 @@ void Attribute::disconnectOutput(Attribute *attribute){
 }
 
 bool Attribute::isClean(){
-	return _isClean;
+	return _cleanEpoch > _dirtyEpoch;
 }
 
 void Attribute::setIsClean(bool value){
-	_isClean = value;
+	if(value){
+		if(_cleanEpoch <= _dirtyEpoch){
+			_cleanEpoch = _dirtyEpoch + 1;
+			
+			// set by its node while computing another attribute, we can't tell if the value changed
+			_changedEpoch = _evaluationEpoch;
+			_hasContentHash = false;
+		}
+	}
+	else{
+		_cleanEpoch = _dirtyEpoch;
+	}
 }
 
 void Attribute::setIsOutput(bool value){
@@ -261,14 +307,15 @@ void Attribute::addAffectedFrom(Attribute *attribute){
 void Attribute::addAffect(Attribute *attribute){
 	if(attribute){
 		if(containerUtils::elementInContainer(attribute, _affect) == false){
+			AsyncEvaluation::cancelPending(this);
+			AsyncEvaluation::cancelPending(attribute);
+			
 			_affect.push_back(attribute);
 			
 			if(attribute->isAffectedBy(this) == false){
 				attribute->addAffectedFrom(this);
 			}
 			
-			NetworkManager::addEdge(this, attribute);
-			
 			cacheEvaluationChain();
 		}
 	}
@@ -291,110 +338,540 @@ void Attribute::valueChanged(){
 Value *Attribute::value(){
 	clean();
 	
-	return _inputValue;
+	return TimeSampler::sampleValue(_inputValue);
+}
+
+boost::shared_ptr<AsyncEvaluation> Attribute::requestValueAsync(){
+	return AsyncEvaluation::start(this);
 }
 
 Value *Attribute::outValue(){
-	return _value;
+	return TimeSampler::sampleValue(_value);
+}
+
+unsigned int Attribute::newVisitStamp(){
+	return ++_lastVisitStamp;
+}
+
+unsigned int Attribute::newEvaluationEpoch(){
+	return ++_evaluationEpoch;
+}
+
+void Attribute::collectDirtyUpstream(const std::vector<Attribute*> &seeds, std::vector<Attribute*> &attributes){
+	// upstream of a clean attribute everything is clean already, so the search stops there.
+	unsigned int visitStamp = newVisitStamp();
+	
+	for(int i = 0; i < seeds.size(); ++i){
+		Attribute *seed = seeds[i];
+		if(seed->_visitStamp != visitStamp){
+			seed->_visitStamp = visitStamp;
+			attributes.push_back(seed);
+		}
+	}
+	
+	for(int i = 0; i < attributes.size(); ++i){
+		Attribute *attr = attributes[i];
+		
+		Attribute *input = attr->_input;
+		if(input && input->isClean() == false && input->_visitStamp != visitStamp){
+			input->_visitStamp = visitStamp;
+			attributes.push_back(input);
+		}
+		
+		// lazy inputs are only evaluated if their node reads them
+		for(int j = 0; j < attr->_affectedBy.size(); ++j){
+			Attribute *affectedBy = attr->_affectedBy[j];
+			if(affectedBy->_isLazy == false && affectedBy->isClean() == false && affectedBy->_visitStamp != visitStamp){
+				affectedBy->_visitStamp = visitStamp;
+				attributes.push_back(affectedBy);
+			}
+		}
+	}
+}
+
+EvaluationContext *Attribute::evaluationContext(){
+	if(_evaluationPlan){
+		return _evaluationPlan->context();
+	}
+	
+	return &_defaultEvaluationContext;
 }
 
 void Attribute::clean(){
-	if(!_cleaningLocked){
-		if(_isClean == false){
-			if(_isInput && _input == 0){
-				_isClean = true;
+	if(isClean() == false){
+		if(!_evaluationPlan){
+			EvaluationPlan::build(this);
+		}
+		
+		if(_evaluationPlan->context()->isEvaluating()){
+			// an asynchronous evaluation requested by this thread is in progress, its result is the value we are after
+			AsyncEvaluation::waitPending(this);
+			
+			if(isClean()){
+				return;
 			}
+		}
+		
+		if(!_evaluationPlan->context()->isEvaluating()){
+			cleanGroup(std::vector<Attribute*>(1, this));
+		}
+		else if(_isLazy){
+			// read by its node while the network is being cleaned
+			cleanLazyInput();
+		}
+	}
+}
 
-			_cleaningLocked = true;
+void Attribute::clean(const std::vector<Attribute*> &attributes){
+	// attributes sharing a plan are cleaned by one evaluation, so that their common upstream is scheduled only once.
+	// Different plans belong to networks that are not connected to each other, each has its own context and they are cleaned concurrently.
+	std::vector<std::vector<Attribute*> > groups;
+	std::map<EvaluationPlan*, int> groupByPlan;
+	
+	for(int i = 0; i < attributes.size(); ++i){
+		Attribute *attr = attributes[i];
+		if(attr->isClean() == false){
+			if(!attr->_evaluationPlan){
+				EvaluationPlan::build(attr);
+			}
 			
-			boost::posix_time::ptime startTime = boost::posix_time::microsec_clock::universal_time();
+			EvaluationPlan *plan = attr->_evaluationPlan.get();
+			if(plan->context()->isEvaluating() || NetworkManager::isBatchEditing()){
+				// plans don't reflect the groups while a batch edit is in progress
+				attr->clean();
+				continue;
+			}
 			
-			for(std::map<int, std::vector<Attribute*> >::iterator i = _cleanChain.begin(); i != _cleanChain.end(); ++i){
-				std::vector<Attribute*> &outputAttributes = i->second;
-
-				#ifdef CORAL_PARALLEL_TBB
-					tbb::parallel_for(tbb::blocked_range<size_t>(0, outputAttributes.size()), attribute_parallelClean(&outputAttributes));
-				#else
-					for(int j = 0; j < outputAttributes.size(); ++j){
-						outputAttributes[j]->cleanSelf();
+			std::map<EvaluationPlan*, int>::iterator it = groupByPlan.find(plan);
+			if(it == groupByPlan.end()){
+				groupByPlan[plan] = groups.size();
+				groups.push_back(std::vector<Attribute*>(1, attr));
+			}
+			else{
+				groups[it->second].push_back(attr);
+			}
+		}
+	}
+	
+	#ifdef CORAL_PARALLEL_TBB
+		tbb::parallel_for(tbb::blocked_range<size_t>(0, groups.size()), attribute_parallelCleanGroups(&groups));
+	#else
+		for(int i = 0; i < groups.size(); ++i){
+			cleanGroup(groups[i]);
+		}
+	#endif
+}
+
+void Attribute::cleanGroup(const std::vector<Attribute*> &attributes){
+	// keeps the context alive in case the plan gets rebuilt during the evaluation
+	boost::shared_ptr<EvaluationPlan> planRef = attributes[0]->_evaluationPlan;
+	EvaluationContext *context = planRef->context();
+	
+	_evaluationEpoch++;
+	
+	for(int i = 0; i < attributes.size(); ++i){
+		Attribute *attr = attributes[i];
+		if(attr->_isInput && attr->_input == 0){
+			attr->_cleanEpoch = _evaluationEpoch;
+		}
+	}
+	
+	context->setIsEvaluating(true);
+	ProfilerScope profilerScope(Profiler::spanTypeEvaluation, attributes[0]);
+	
+	boost::posix_time::ptime startTime = boost::posix_time::microsec_clock::universal_time();
+	
+	bool nested = false;
+	evaluate(attributes, nested);
+	
+	boost::posix_time::ptime endTime = boost::posix_time::microsec_clock::universal_time();
+	int computeTimeSeconds = boost::posix_time::time_period(startTime, endTime).length().total_seconds();
+	int computeTimeMilliseconds = boost::posix_time::time_period(startTime, endTime).length().total_milliseconds() % 1000;
+	for(int i = 0; i < attributes.size(); ++i){
+		attributes[i]->_computeTimeSeconds = computeTimeSeconds;
+		attributes[i]->_computeTimeMilliseconds = computeTimeMilliseconds;
+	}
+	
+	context->setIsEvaluating(false);
+}
+
+void Attribute::cleanLazyInput(){
+	#ifdef CORAL_PARALLEL_TBB
+		// lazy branches of different nodes may share some of their upstream, their evaluations are serialized.
+		tbb::recursive_mutex::scoped_lock lock(evaluationContext()->lazyEvaluationMutex());
+	#endif
+	
+	if(isClean() == false){
+		bool nested = true;
+		evaluate(std::vector<Attribute*>(1, this), nested);
+	}
+}
+
+void Attribute::evaluate(const std::vector<Attribute*> &seeds, bool nested){
+	std::vector<Attribute*> attributes;
+	collectDirtyUpstream(seeds, attributes);
+	
+	// plans are out of date while a batch edit is in progress.
+	// A nested evaluation runs within the group whose plan was just validated by the outer one.
+	boost::shared_ptr<EvaluationPlan> &plan = seeds[0]->_evaluationPlan;
+	if(!nested){
+		bool planOutOfDate = !plan || NetworkManager::isBatchEditing();
+		for(int i = 0; i < attributes.size() && !planOutOfDate; ++i){
+			planOutOfDate = attributes[i]->_evaluationPlan != plan;
+		}
+		
+		if(planOutOfDate){
+			if(seeds.size() > 1){
+				// the seeds may not belong to the same group anymore
+				for(int i = 0; i < seeds.size(); ++i){
+					if(seeds[i]->isClean() == false){
+						evaluate(std::vector<Attribute*>(1, seeds[i]), nested);
 					}
-				#endif
+				}
+				
+				return;
 			}
 			
-			boost::posix_time::ptime endTime = boost::posix_time::microsec_clock::universal_time();
-			_computeTimeSeconds = boost::posix_time::time_period(startTime, endTime).length().total_seconds();
-			_computeTimeMilliseconds = boost::posix_time::time_period(startTime, endTime).length().total_milliseconds() % 1000;
-			
-			_cleaningLocked = false;
+			EvaluationPlan::build(seeds[0]);
+		}
+	}
+	
+	std::vector<std::pair<int, Attribute*> > sortedAttributes(attributes.size());
+	for(int i = 0; i < attributes.size(); ++i){
+		sortedAttributes[i] = std::pair<int, Attribute*>(attributes[i]->_planIndex, attributes[i]);
+	}
+	std::sort(sortedAttributes.begin(), sortedAttributes.end());
+	
+	std::vector<Attribute*> tasks;
+	for(int i = 0; i < sortedAttributes.size(); ++i){
+		Attribute *attr = sortedAttributes[i].second;
+		if(EvaluationPlan::isTask(attr)){
+			tasks.push_back(attr);
+		}
+	}
+	
+	std::vector<std::vector<Attribute*> > taskGroups;
+	plan->groupTasks(tasks, taskGroups);
+	plan->context()->updatesPlanned(taskGroups.size());
+	
+	#ifdef CORAL_PARALLEL_TBB
+	if(!nested){
+		std::vector<CleanTask> cleanTasks;
+		plan->collectCleanTasks(taskGroups, cleanTasks);
+		
+		std::vector<tbb::atomic<int> > pendingPredecessors(cleanTasks.size());
+		std::vector<int> readyTasks;
+		for(int i = 0; i < cleanTasks.size(); ++i){
+			pendingPredecessors[i] = cleanTasks[i].predecessors;
+			if(cleanTasks[i].predecessors == 0){
+				readyTasks.push_back(i);
+			}
+		}
+		
+		tbb::parallel_do(readyTasks.begin(), readyTasks.end(), attribute_parallelCleanTask(&cleanTasks, &pendingPredecessors));
+	}
+	else
+	#endif
+	{
+		for(int i = 0; i < taskGroups.size(); ++i){
+			cleanTaskGroup(taskGroups[i]);
+		}
+	}
+	
+	// inputs and passThroughs are clean too now, unless the output feeding them was left dirty by its node, 
+	// in which case they stay dirty but are marked as seen by this pass.
+	for(int i = 0; i < sortedAttributes.size(); ++i){
+		Attribute *attr = sortedAttributes[i].second;
+		if(!EvaluationPlan::isTask(attr)){
+			if(attr->_input == 0 || attr->_input->isClean()){
+				attr->_cleanEpoch = _evaluationEpoch;
+			}
+			else{
+				attr->_cleanEpoch = attr->_dirtyEpoch;
+			}
+		}
+	}
+	
+	markUnreadLazyInputs(tasks);
+}
+
+void Attribute::markUnreadLazyInputs(const std::vector<Attribute*> &tasks){
+	// The branches behind lazy inputs that were not read stay dirty while the outputs they affect may be clean now,
+	// they are marked as seen by this pass so that the next dirty pass doesn't stop propagating at them.
+	unsigned int visitStamp = newVisitStamp();
+	
+	std::vector<Attribute*> attributes;
+	for(int i = 0; i < tasks.size(); ++i){
+		Attribute *task = tasks[i];
+		for(int j = 0; j < task->_affectedBy.size(); ++j){
+			Attribute *affectedBy = task->_affectedBy[j];
+			if(affectedBy->_isLazy && affectedBy->isClean() == false && affectedBy->_visitStamp != visitStamp){
+				affectedBy->_visitStamp = visitStamp;
+				attributes.push_back(affectedBy);
+			}
+		}
+	}
+	
+	for(int i = 0; i < attributes.size(); ++i){
+		Attribute *attr = attributes[i];
+		attr->_cleanEpoch = attr->_dirtyEpoch;
+		
+		Attribute *input = attr->_input;
+		if(input && input->isClean() == false && input->_visitStamp != visitStamp){
+			input->_visitStamp = visitStamp;
+			attributes.push_back(input);
+		}
+		
+		for(int j = 0; j < attr->_affectedBy.size(); ++j){
+			Attribute *affectedBy = attr->_affectedBy[j];
+			if(affectedBy->isClean() == false && affectedBy->_visitStamp != visitStamp){
+				affectedBy->_visitStamp = visitStamp;
+				attributes.push_back(affectedBy);
+			}
 		}
 	}
 }
 
 void Attribute::cleanSelf(){
-	if(_isClean == false){
-		_isClean = true;
+	EvaluationContext *context = evaluationContext();
+	if(isClean() == false && !context->isCancelled()){
+		// the node may still refuse to compute this attribute by calling setAttributeIsClean(attribute, false)
+		_cleanEpoch = _evaluationEpoch;
 
 		Node *parentNode = parent();
 		if(parentNode){
-			std::vector<Attribute*> inputsToClean = _inputsCleanChain[id()];
-			for(int i = 0; i < inputsToClean.size(); ++i){
-				inputsToClean[i]->_isClean = true;
-			}	
+			if(parentNode->updateEnabled() && needsUpdate()){
+				if(parentNode->updateOutputsTogether()){
+					parentNode->doUpdate(std::vector<Attribute*>(1, this));
+				}
+				else{
+					parentNode->doUpdate(this);
+				}
+				
+				// cancelled halfway through its slices
+				if(parentNode->_slicer && context->isCancelled()){
+					setIsClean(false);
+					return;
+				}
+				
+				_computedEpoch = _evaluationEpoch;
+				_computeCount++;
+				updateChangedEpoch();
+				context->nodeUpdated(parentNode);
+			}
+		}
+	}
+}
+
+void Attribute::cleanTaskGroup(const std::vector<Attribute*> &attributes){
+	if(attributes.size() == 1){
+		attributes[0]->cleanSelf();
+		return;
+	}
+	
+	// outputs of a node declared as setUpdateOutputsTogether(true), computed by one update
+	Node *parentNode = attributes[0]->parent();
+	EvaluationContext *context = attributes[0]->evaluationContext();
+	if(context->isCancelled()){
+		return;
+	}
+	
+	std::vector<Attribute*> outputs;
+	for(int i = 0; i < attributes.size(); ++i){
+		Attribute *attr = attributes[i];
+		if(attr->isClean() == false){
+			attr->_cleanEpoch = _evaluationEpoch;
 			
-			if(parentNode->updateEnabled()){
-				parentNode->doUpdate(this);
+			if(parentNode->updateEnabled() && attr->needsUpdate()){
+				outputs.push_back(attr);
 			}
 		}
 	}
+	
+	if(outputs.size()){
+		parentNode->doUpdate(outputs);
+		
+		if(parentNode->_slicer && context->isCancelled()){
+			for(int i = 0; i < outputs.size(); ++i){
+				outputs[i]->setIsClean(false);
+			}
+			
+			return;
+		}
+		
+		for(int i = 0; i < outputs.size(); ++i){
+			outputs[i]->_computedEpoch = _evaluationEpoch;
+			outputs[i]->_computeCount++;
+			outputs[i]->updateChangedEpoch();
+		}
+		
+		context->nodeUpdated(parentNode);
+	}
 }
 
-void Attribute::setNotifyParentNodeOnDirty(bool value){
-	_notifyParentNodeOnDirty = value;
+bool Attribute::needsUpdate(){
+	// early cutoff: if none of the attributes affecting this one changed since its last update the current value still holds.
+	// Nodes nested in a slicer are always updated, the number of slices might have changed.
+	if(NetworkManager::earlyCutoff() && _computedEpoch && parent()->_slicer == 0){
+		return inputsChangedSince(_computedEpoch);
+	}
+	
+	return true;
 }
 
-void Attribute::dirty(bool force){
-	if(!_cleaningLocked){
-		if(_isClean || force){
-			for(int i = 0; i < _dirtyChain.size(); ++i){
-				Attribute* attr = _dirtyChain[i];
-				attr->_isClean = false;
-				attr->onDirtied();
-				
-				if(attr->_notifyParentNodeOnDirty){
-					Node *parentNode = attr->parent();
-					if(parentNode){
-						parentNode->attributeDirtied(attr);
-					}
-				}
+bool Attribute::inputsChangedSince(unsigned int epoch){
+	for(int i = 0; i < _affectedBy.size(); ++i){
+		for(Attribute *attr = _affectedBy[i]; attr; attr = attr->_input){
+			if(attr->_changedEpoch > epoch){
+				return true;
 			}
+		}
+	}
+	
+	return false;
+}
 
-			processDirtyingDoneCallbackQueue();
+void Attribute::updateChangedEpoch(){
+	if(NetworkManager::earlyCutoff() && _value && isClean()){
+		std::size_t hash = 0;
+		if(_value->contentHash(hash)){
+			bool changed = !_hasContentHash || hash != _contentHash;
+			
+			_contentHash = hash;
+			_hasContentHash = true;
+			
+			if(!changed){
+				return;
+			}
+		}
+		else{
+			_hasContentHash = false;
 		}
 	}
+	else{
+		_hasContentHash = false;
+	}
+	
+	_changedEpoch = _evaluationEpoch;
+}
+
+void Attribute::setNotifyParentNodeOnDirty(bool value){
+	_notifyParentNodeOnDirty = value;
+}
+
+void Attribute::setIsLazy(bool value){
+	_isLazy = value;
 	
-	for(int i = 0; i < _dirtyChain.size(); ++i){
-		Attribute* attr = _dirtyChain[i];
+	NetworkManager::graphChanged();
+}
+
+bool Attribute::isLazy(){
+	return _isLazy;
+}
+
+void Attribute::setIsAnimatedSource(bool value){
+	if(value != _isAnimatedSource){
+		_isAnimatedSource = value;
+		
+		cacheEvaluationChain();
 	}
 }
 
-void Attribute::forceDirty(){
-	dirty(true);
+bool Attribute::isAnimated(){
+	if(_evaluationPlan){
+		return _evaluationPlan->isAnimatedAt(_planIndex);
+	}
+	
+	return _isAnimatedSource;
 }
 
-void Attribute::processDirtyingDoneCallbackQueue(){
-	for(int i = 0; i < _dirtyingDoneCallbackQueue.size(); ++i){
-		_dirtyingDoneCallbackQueue[i](this);
+int Attribute::dirtyCount(){
+	return _dirtyCount;
+}
+
+int Attribute::computeCount(){
+	return _computeCount;
+}
+
+void Attribute::resetCounters(){
+	_dirtyCount = 0;
+	_computeCount = 0;
+}
+
+std::size_t Attribute::valueBytes(){
+	if(_value && !_passThrough){
+		return _value->sizeInBytes();
 	}
 	
-	_dirtyingDoneCallbackQueue.clear();
+	return 0;
 }
 
-void Attribute::queueDirtyingDoneCallback(void(*callback)(Attribute *)){
-	#ifdef CORAL_PARALLEL_TBB
-		tbb::mutex::scoped_lock lock(_globalMutex);
-	#endif
+void Attribute::dirty(bool force){
+	AsyncEvaluation::cancelPending(this);
+	
+	if(!evaluationContext()->isEvaluating()){
+		if(_dirtyEpoch <= _cleanEpoch || force){
+			std::vector<Attribute*> attributes(1, this);
+			dirtyDownstream(attributes, force);
+		}
+		else{
+			// downstream is dirty already, but this attribute's value or connection did change
+			_changedEpoch = ++_evaluationEpoch;
+		}
+	}
+}
+
+void Attribute::dirtyDownstream(const std::vector<Attribute*> &attributes, bool force){
+	unsigned int dirtyEpoch = ++_evaluationEpoch;
+	
+	std::vector<Attribute*> toVisit(attributes.rbegin(), attributes.rend());
+	for(int i = 0; i < toVisit.size(); ++i){
+		toVisit[i]->_dirtyEpoch = dirtyEpoch;
+		toVisit[i]->_changedEpoch = dirtyEpoch;
+	}
+	
+	while(toVisit.empty() == false){
+		Attribute *attr = toVisit.back();
+		toVisit.pop_back();
+		
+		attr->_dirtyCount++;
+		attr->onDirtied();
+		
+		if(attr->_notifyParentNodeOnDirty){
+			Node *parentNode = attr->parent();
+			if(parentNode){
+				parentNode->attributeDirtied(attr);
+			}
+		}
+		
+		for(int i = attr->_affect.size() - 1; i >= 0; --i){
+			Attribute *affected = attr->_affect[i];
+			if(affected->_dirtyEpoch != dirtyEpoch && (affected->_dirtyEpoch <= affected->_cleanEpoch || force)){
+				affected->_dirtyEpoch = dirtyEpoch;
+				toVisit.push_back(affected);
+			}
+		}
+		
+		for(int i = attr->_outputs.size() - 1; i >= 0; --i){
+			Attribute *output = attr->_outputs[i];
+			if(output->_dirtyEpoch != dirtyEpoch && (output->_dirtyEpoch <= output->_cleanEpoch || force)){
+				output->_dirtyEpoch = dirtyEpoch;
+				toVisit.push_back(output);
+			}
+		}
+	}
 	
-	_dirtyingDoneCallbackQueue.push_back(callback);
+	if(attributes.size()){
+		attributes[0]->evaluationContext()->processDirtyingDoneCallbacks(attributes[0]);
+	}
+}
+
+void Attribute::forceDirty(){
+	dirty(true);
+}
+
+void Attribute::queueDirtyingDoneCallback(void(*callback)(Attribute *)){
+	evaluationContext()->queueDirtyingDoneCallback(callback);
 }
 
 Attribute *Attribute::findFirstOutputNotPassThrough(){
@@ -439,8 +916,6 @@ void Attribute::setInput(Attribute *attribute){
 			_input = attribute;
 			_inputValue = _value;
 
-			NetworkManager::addEdge(_input, this);
-
 			resetInputValuesInChain();
 			
 			if(_input->_passThrough){
@@ -459,6 +934,10 @@ bool Attribute::connectTo(Attribute *attribute, ErrorObject *errorObject){
 	bool resetBranchSpecialization = false;
 	bool success = updateBranchSpecializations(resetBranchSpecialization);
 	
+	if(NetworkManager::isBatchEditing()){
+		NetworkManager::deferConnectionCheck(this, attribute);
+	}
+	
 	if(parent()){
 		parent()->_attributeConnectionChanged(this);
 	}
@@ -489,6 +968,8 @@ const std::vector<Attribute*> &Attribute::outputs(){
 }
 
 void Attribute::deleteIt(){
+	AsyncEvaluation::cancelPending(this);
+	
 	if(_deleteItCallback && !isDeleted()){
 		_deleteItCallback(this);
 	}
@@ -526,6 +1007,8 @@ void Attribute::deleteIt(){
 		_value = 0;
 	}
 	
+	NetworkManager::graphChanged();
+	
 	setIsDeleted(true);
 }
 
@@ -571,166 +1054,14 @@ std::vector<std::string> Attribute::allowedSpecialization(){
 	return _allowedSpecialization;
 }
 
-void Attribute::collectSpecializationBranch(std::vector<std::pair<Attribute*, Attribute*> > &specializationPairs, std::vector<std::pair<Attribute*, Attribute*> > &specializationLinks, std::map<int, std::vector<std::string> > &specializationMap, bool reset){
-	int thisId = id();
-	if(specializationMap.find(thisId) == specializationMap.end()){
-		if(reset){
-			if(_specializationOverride.size() == 1){
-				specializationMap[thisId] = _specializationOverride;
-			}
-			else{
-				specializationMap[thisId] = _allowedSpecialization;
-			}
-		}
-		else{
-			specializationMap[thisId] = _specialization;
-		}
-		
-		for(int i = 0; i < _specializationLinks.size(); ++i){
-			Attribute *attributeA = _specializationLinks[i]->attributeA;
-			Attribute *attributeB = _specializationLinks[i]->attributeB;
-
-			std::pair<Attribute*, Attribute*> specLink(attributeA, attributeB);
-			if(containerUtils::elementInContainer(specLink, specializationLinks) == false){
-				specializationLinks.push_back(specLink);
-			}
-
-			if(this != attributeA){
-				attributeA->collectSpecializationBranch(specializationPairs, specializationLinks, specializationMap, reset);
-			}
-			else{
-				attributeB->collectSpecializationBranch(specializationPairs, specializationLinks, specializationMap, reset);
-			}
-		}
-		
-		if(_input){
-			std::pair<Attribute*, Attribute*> specPair(_input, this);
-			if(containerUtils::elementInContainer(specPair, specializationPairs) == false){
-				specializationPairs.push_back(specPair);
-			}
-
-			_input->collectSpecializationBranch(specializationPairs, specializationLinks, specializationMap, reset);
-		}
-
-		for(int i = 0; i < _outputs.size(); ++i){
-			std::pair<Attribute*, Attribute*> specPair(this, _outputs[i]);
-			if(containerUtils::elementInContainer(specPair, specializationPairs) == false){
-				specializationPairs.push_back(specPair);
-			}
-
-			_outputs[i]->collectSpecializationBranch(specializationPairs, specializationLinks, specializationMap, reset);
-		}
-	}
-}
-
-bool Attribute::updateSpecialization(std::vector<std::pair<Attribute*, Attribute*> > &specializationPairs, std::vector<std::pair<Attribute*, Attribute*> > &specializationLinks, std::map<int, std::vector<std::string> > &specializationMap){
-	int oldUnresolved = specializationLinks.size() + specializationPairs.size();
-
-	// solve links
-	std::vector<std::pair<Attribute*, Attribute*> >::iterator specLinksIt = specializationLinks.begin();
-	while(specLinksIt != specializationLinks.end()){
-		std::pair<Attribute*, Attribute*> &specLink = *specLinksIt;
-		Attribute *attrA = specLink.first;
-		Attribute *attrB = specLink.second;
-
-		std::vector<std::string> &specA = specializationMap[attrA->id()];
-		std::vector<std::string> &specB = specializationMap[attrB->id()];
-
-		if(specA.size() > 1 || specB.size() > 1){
-			Node *parentNode = attrA->parent();
-			if(parentNode){
-				parentNode->updateSpecializationLink(attrA, attrB, specA, specB);
-			}
-		}
-
-		if(specA.size() == 1 && specB.size() == 1){
-			specLinksIt = specializationLinks.erase(specLinksIt);
-		}
-		else{
-			++specLinksIt;
-		}
+bool Attribute::updateBranchSpecializations(bool reset, std::set<int> *solvedAttributes){
+	// solved by NetworkManager::endBatchEdit(), which reports the connections failing then
+	if(NetworkManager::isBatchEditing()){
+		NetworkManager::deferBranchSpecializations(this, reset);
+		return true;
 	}
-
-	// solve pairs
-	std::vector<std::pair<Attribute*, Attribute*> >::iterator specPairsIt = specializationPairs.begin();
-	while(specPairsIt != specializationPairs.end()){
-		std::pair<Attribute*, Attribute*> &specPair = *specPairsIt;
-
-		Attribute *attrA = specPair.first;
-		Attribute *attrB = specPair.second;
-
-		std::vector<std::string> &specA = specializationMap[attrA->id()];
-		std::vector<std::string> &specB = specializationMap[attrB->id()];
-
-		if(attrA->_passThrough && specA.size() == 0){
-			specA = specB;
-		}
-		else if(attrB->_passThrough && specB.size() == 0){
-			specB = specA;
-		}
-		else if(specA != specB){
-			std::vector<std::string> newSpec = intersectedSpecialization(specA, specB);
-			
-			specA = newSpec;
-			specB = newSpec;
-		}
-
-		if(specA.size() == 1 && specB.size() == 1){
-			specPairsIt = specializationPairs.erase(specPairsIt);
-		}
-		else{
-			++specPairsIt;
-		}
-	}
-
-	int currentUnresolved = specializationLinks.size() + specializationPairs.size();
-
-	bool complete = false;
-	if(oldUnresolved == currentUnresolved){
-		complete = true;
-	}
-
-	return complete;
-}
-
-bool Attribute::updateBranchSpecializations(bool reset){
-	bool success = true;
-
-	// collect
-	std::map<int, std::vector<std::string> > specializationMap;
-	std::vector<std::pair<Attribute*, Attribute*> > specializationPairs;
-	std::vector<std::pair<Attribute*, Attribute*> > specializationLinks;
-	collectSpecializationBranch(specializationPairs, specializationLinks, specializationMap, reset);
-
-	// specialize
-	int maxIter = 100;
-	int i = 0;
-	for(; i < maxIter; ++i){
-		bool complete = updateSpecialization(specializationPairs, specializationLinks, specializationMap);
-		if(complete){
-			break;
-		}
-	}
-
-	if(i == maxIter){
-		std::cout << "Maximum recursion reached during specialization." << std::endl;
-		success = false;
-	}
-
-	// set resulting specialization
-	std::map<int, std::vector<std::string> >::iterator specializationMapIt = specializationMap.begin();
-	for(; specializationMapIt != specializationMap.end(); ++specializationMapIt){
-		int id = specializationMapIt->first;
-		std::vector<std::string> newSpec = specializationMapIt->second;
 	
-		Object *object = NetworkManager::findObjectById(id);
-		if(object){
-			Attribute *attribute = (Attribute*)object;
-			attribute->setSpecialization(newSpec);
-		}
-	}
-
-	return success;
+	return SpecializationSolver::solve(this, reset, solvedAttributes);
 }
 
 void Attribute::onSettingSpecialization(const std::vector<std::string> &specialization){
@@ -808,7 +1139,7 @@ std::string Attribute::shortDebugInfo(){
 
 	info += "attribute: " + fullName() + "\n";
 	info += "className: " + className() + "\n";
-	info += "isClean: " + stringUtils::boolToString(_isClean) + "\n";
+	info += "isClean: " + stringUtils::boolToString(isClean()) + "\n";
 	info += "allowedSpecialization: " + stringUtils::vectorToString<std::string>(_allowedSpecialization) + "\n";
 	info += "specialization: " + stringUtils::vectorToString<std::string>(_specialization);
 
@@ -820,46 +1151,33 @@ std::string Attribute::debugInfo(){
 	
 	info += "last cleaning took: secs:" + stringUtils::intToString(_computeTimeSeconds) + ", millisecs: " + stringUtils::intToString(_computeTimeMilliseconds) + "\n";
 	
-	info += "dirty chain: [";
-	for(int i = 0; i < _dirtyChain.size(); ++i){
-		info += _dirtyChain[i]->fullName() + ", ";
+	if(_evaluationPlan){
+		info += "evaluation plan: index " + stringUtils::intToString(_planIndex) + " of " + stringUtils::intToString(_evaluationPlan->size());
+		info += ", level " + stringUtils::intToString(_evaluationPlan->levelAt(_planIndex)) + "\n";
 	}
-	info += "]\n";
 	
-	info += "clean chain: [";
-	for(std::map<int, std::vector<Attribute*> >::iterator i = _cleanChain.begin(); i != _cleanChain.end(); ++i){
-		std::vector<Attribute*> &outputAttributes = i->second;
-		info += "[";
-		for(int j = 0; j < outputAttributes.size(); ++j){
-			Node *parentNode = outputAttributes[j]->parent();
-			info += parentNode->fullName() + ", ";
-		}
-		info += "] -> ";
+	if(isAnimated()){
+		info += "animated\n";
+	}
+	else{
+		info += "static\n";
 	}
-	info += "]\n";
+	
+	info += "dirtied: " + stringUtils::intToString(_dirtyCount) + ", computed: " + stringUtils::intToString(_computeCount);
+	info += ", value bytes: " + stringUtils::intToString(valueBytes()) + "\n";
 	
 	return info;
 }
 
-void Attribute::cacheDirtyChainUpstream(){
-	std::vector<Attribute*> attributes;
-	NetworkManager::getUpstreamChain(this, attributes);
-	for(int i = 0; i < attributes.size(); ++i){
-		NetworkManager::getDownstreamChain(attributes[i], attributes[i]->_dirtyChain);
-	}
-}
-
-void Attribute::cacheCleanChainDownstream(){
-	std::vector<Attribute*> attributes;
-	NetworkManager::getDownstreamChain(this, attributes);
-	for(int i = 0; i < attributes.size(); ++i){
-		NetworkManager::getCleanChain(attributes[i], attributes[i]->_cleanChain, attributes[i]->_inputsCleanChain);
-	}
-}
-
 void Attribute::cacheEvaluationChain(){
-	cacheDirtyChainUpstream();
-	cacheCleanChainDownstream();
+	NetworkManager::graphChanged();
+	
+	if(NetworkManager::isBatchEditing()){
+		NetworkManager::deferEvaluationChain(this);
+		return;
+	}
+	
+	EvaluationPlan::build(this);
 }
 
 std::vector<Attribute*> Attribute::specializationLinkedTo(){
@@ -895,12 +1213,32 @@ Attribute *Attribute::connectedNonPassThrough(){
     	}
     }
 
-	for(int i = 0; i < _dirtyChain.size(); ++i){
-		Attribute *outAttr = _dirtyChain[i];
+	unsigned int visitStamp = newVisitStamp();
+	std::vector<Attribute*> downstream(1, this);
+	_visitStamp = visitStamp;
+	
+	for(int i = 0; i < downstream.size(); ++i){
+		Attribute *outAttr = downstream[i];
 		if(!outAttr->_passThrough){
-			return  outAttr;
+			return outAttr;
+		}
+		
+		for(int j = 0; j < outAttr->_outputs.size(); ++j){
+			Attribute *output = outAttr->_outputs[j];
+			if(output->_visitStamp != visitStamp){
+				output->_visitStamp = visitStamp;
+				downstream.push_back(output);
+			}
 		}
-	} 
+		
+		for(int j = 0; j < outAttr->_affect.size(); ++j){
+			Attribute *affected = outAttr->_affect[j];
+			if(affected->_visitStamp != visitStamp){
+				affected->_visitStamp = visitStamp;
+				downstream.push_back(affected);
+			}
+		}
+	}
 
     return 0;
 }
@@ -32,8 +32,10 @@
 
 #include <vector>
 #include <map>
+#include <set>
 #include <time.h>
 #include <iostream>
+#include <boost/shared_ptr.hpp>
 
 #include "NestedObject.h"
 
@@ -44,7 +46,10 @@ class AttributeAccessor;
 class NetworkManager;
 class SpecializationLink;
 class ErrorObject;
-class attribute_parallelClean;
+class attribute_parallelCleanTask;
+class EvaluationPlan;
+class EvaluationContext;
+class AsyncEvaluation;
 class Attribute;
 
 struct SpecializationLink{
@@ -53,6 +58,13 @@ struct SpecializationLink{
 	Attribute *attributeB;
 };
 
+struct CleanTask{
+	// Helper struct to hold one entry of the parallel clean task graph, not exposed to public API
+	std::vector<Attribute*> attributes;
+	int predecessors;
+	std::vector<int> successors;
+};
+
 //! The base class for customized attributes.
 //
 //! Internally it stores a pointer to a Value, 
@@ -84,6 +96,25 @@ public:
 	void removeSpecializationOverride();
 	void forceSpecializationUpdate();
 	void forceDirty();
+	
+	//! Lazy inputs are not cleaned along with the rest of the network, they get evaluated the first time 
+	//! their node reads them through value() while updating. See Node::setAttributeIsLazy().
+	bool isLazy();
+	
+	//! Returns true if this attribute may change from frame to frame: it's an animated source, such as the time of a Time node, 
+	//! or it's affected by one upstream. Static attributes only get dirty when one of their static inputs is edited, 
+	//! so they stay clean across frames.
+	bool isAnimated();
+	
+	//! Counters kept since the creation of this attribute or the last call to resetCounters(): 
+	//! dirtyCount() is the number of dirty passes that reached this attribute and computeCount() the number of updates that actually computed it. 
+	//! Attributes dirtied much more often than they get computed point to wasted dirty propagation.
+	int dirtyCount();
+	int computeCount();
+	void resetCounters();
+	
+	//! The memory held by the value of this attribute, see Value::sizeInBytes().
+	std::size_t valueBytes();
 
 	/*! Returns the first connected attribute found that is not a passThrough.
 		This method should be used whenever trying to access the internal value of this attribute wihtout knowing if it's a passThrough.*/
@@ -118,6 +149,14 @@ public:
 		then you must use outValue() instead.*/
 	Value *value();
 	
+	//! Starts cleaning this attribute in the background and returns right away, see AsyncEvaluation.
+	//! value() called afterwards from the same thread waits for the evaluation to be done, outValue() doesn't and must not be read until then.
+	boost::shared_ptr<AsyncEvaluation> requestValueAsync();
+	
+	//! Cleans all the given attributes at once, their common upstream is computed only once 
+	//! and the ones belonging to networks not connected to each other are cleaned concurrently.
+	static void clean(const std::vector<Attribute*> &attributes);
+	
 	/*! Return this attribute's value without cleaning it, use this method to access the Value for modifying its internal data.*/
 	Value *outValue();
 	
@@ -128,7 +167,9 @@ public:
 	static void(*_deleteItCallback)(Attribute *self);
 	static void(*_specializationCallBack)(Attribute *self);
 	// static void(*_valueChangedCallback)(Attribute *self);
-	static void queueDirtyingDoneCallback(void(*callback)(Attribute *));
+	
+	//! Queues a callback to be invoked once the dirty pass this attribute is part of is done.
+	void queueDirtyingDoneCallback(void(*callback)(Attribute *));
 	
 protected:
 	void setValuePtr(Value *value);
@@ -140,9 +181,16 @@ protected:
 
 private:
 	friend class AttributeAccessor;
-	friend class attribute_parallelClean;
+	friend class attribute_parallelCleanTask;
+	friend class attribute_parallelCleanGroups;
 	friend class Node;
 	friend class NetworkManager;
+	friend class EvaluationPlan;
+	friend class Profiler;
+	friend class SpecializationSolver;
+	friend class CompiledNetwork;
+	friend class AsyncEvaluation;
+	friend class TimeSampler;
 
 	bool connectTo(Attribute *attribute, ErrorObject *errorObject);
 	void addAffectedFrom(Attribute *attribute);
@@ -156,31 +204,42 @@ private:
 	void setParent(Node *parent);
 	void resetInputValuesInChain();
 	void removeSpecializationLink(SpecializationLink *specializationLink);
-	bool updateBranchSpecializations(bool reset);
+	bool updateBranchSpecializations(bool reset, std::set<int> *solvedAttributes = 0);
 	void setSpecialization(const std::vector<std::string> &specialization);
 	bool specializationContainedOne(const std::vector<std::string> &specialization1, const std::vector<std::string> &specialization2);
 	void linkSpecializationTo(Attribute *attribute);
 	void cacheEvaluationChain();
-	void cacheDirtyChainUpstream();
-	void cacheCleanChainDownstream();
+	static void collectDirtyUpstream(const std::vector<Attribute*> &seeds, std::vector<Attribute*> &attributes);
+	static void cleanGroup(const std::vector<Attribute*> &attributes);
+	static void evaluate(const std::vector<Attribute*> &seeds, bool nested);
+	void cleanLazyInput();
+	static void markUnreadLazyInputs(const std::vector<Attribute*> &tasks);
+	static void dirtyDownstream(const std::vector<Attribute*> &attributes, bool force = false);
+	static unsigned int newVisitStamp();
+	static unsigned int newEvaluationEpoch();
+	bool inputsChangedSince(unsigned int epoch);
+	bool needsUpdate();
+	static void cleanTaskGroup(const std::vector<Attribute*> &attributes);
+	void updateChangedEpoch();
 	void cleanSelf();
-	void processDirtyingDoneCallbackQueue();
+	EvaluationContext *evaluationContext();
 	Attribute *findFirstOutputNotPassThrough();
 	void initValueFromPassThroughFirstOutput(Attribute *attribute);
 	void setNotifyParentNodeOnDirty(bool value);
-	void collectSpecializationBranch(std::vector<std::pair<Attribute*, Attribute*> > &specializationPairs, std::vector<std::pair<Attribute*, Attribute*> > &specializationLinks, std::map<int, std::vector<std::string> > &specializationMap, bool reset);
-	bool updateSpecialization(std::vector<std::pair<Attribute*, Attribute*> > &specializationPairs, std::vector<std::pair<Attribute*, Attribute*> > &specializationLinks, std::map<int, std::vector<std::string> > &specializationMap);
+	void setIsLazy(bool value);
+	void setIsAnimatedSource(bool value);
 
 	Attribute *_input;
 	std::vector<Attribute*> _outputs;
 	std::vector<Attribute*> _affect;
 	std::vector<Attribute*> _affectedBy;
-	bool _isClean;
 	bool _isOutput;
 	bool _isInput;
 	bool _passThrough;
 	bool _valueObserved;
 	bool _notifyParentNodeOnDirty;
+	bool _isLazy;
+	bool _isAnimatedSource;
 	Value *_value;
 	Value *_inputValue;
 	std::vector<std::string> _allowedSpecialization;
@@ -189,9 +248,17 @@ private:
 	std::vector<SpecializationLink*> _specializationLinks;
 	int _computeTimeSeconds;
 	int _computeTimeMilliseconds;
-	std::vector<Attribute*> _dirtyChain;
-	std::map<int, std::vector<Attribute*> > _cleanChain;
-	std::map<int, std::vector<Attribute*> > _inputsCleanChain;
+	boost::shared_ptr<EvaluationPlan> _evaluationPlan;
+	int _planIndex;
+	unsigned int _visitStamp;
+	unsigned int _dirtyEpoch;
+	unsigned int _cleanEpoch;
+	unsigned int _changedEpoch;
+	unsigned int _computedEpoch;
+	std::size_t _contentHash;
+	bool _hasContentHash;
+	int _dirtyCount;
+	int _computeCount;
 	
 	Attribute();
 	Attribute(const Attribute &other);
@@ -38,6 +38,23 @@ _slices(1){
 	_boolValuesSliced[0][0] = false;
 }
 
+void Bool::copy(const Value *other){
+	const Bool *otherBool = dynamic_cast<const Bool*>(other);
+	
+	if(otherBool){
+		_boolValuesSliced = otherBool->_boolValuesSliced;
+		_isArray = otherBool->_isArray;
+		_slices = otherBool->_slices;
+	}
+}
+
+Value *Bool::duplicate(){
+	Bool *value = new Bool();
+	value->copy(this);
+	
+	return value;
+}
+
 unsigned int Bool::slices(){
 	return _slices;
 }
@@ -218,6 +235,22 @@ void Bool::setFromString(const std::string &value){
 	}
 }
 
+bool Bool::contentHash(std::size_t &hash){
+	hash = hashBytes(&_isArray, sizeof(bool), 0);
+	for(int i = 0; i < _boolValuesSliced.size(); ++i){
+		const std::vector<bool> &values = _boolValuesSliced[i];
+		
+		// std::vector<bool> is packed, hash it one byte per value
+		std::vector<unsigned char> bytes(values.begin(), values.end());
+		hash = hashBytes(&i, sizeof(int), hash);
+		if(bytes.size()){
+			hash = hashBytes(&bytes[0], bytes.size(), hash);
+		}
+	}
+	
+	return true;
+}
+
 BoolAttribute::BoolAttribute(const std::string &name, Node *parent) : Attribute(name, parent){
 	setClassName("BoolAttribute");
 
@@ -40,6 +40,8 @@ namespace coral{
 class CORAL_EXPORT Bool : public Value{
 public:
 	Bool();
+	void copy(const Value *other);
+	Value *duplicate();
 	unsigned int size();
 	void setBoolValueAt(unsigned int id, bool value);
 	bool boolValueAt(unsigned int id);
@@ -59,6 +61,7 @@ public:
 	void setBoolValuesSlice(unsigned int slice, const std::vector<bool> &values);
 	const std::vector<bool> &boolValuesSlice(unsigned int slice);
 	std::string sliceAsString(unsigned int slice);
+	bool contentHash(std::size_t &hash);
 
 private:
 	std::vector<std::vector<bool> > _boolValuesSliced;
@@ -0,0 +1,301 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+#include <map>
+#include <algorithm>
+
+#include "CompiledNetwork.h"
+#include "Attribute.h"
+#include "Node.h"
+#include "EvaluationPlan.h"
+#include "EvaluationContext.h"
+#include "NetworkManager.h"
+#include "Profiler.h"
+
+using namespace coral;
+
+CompiledNetwork::CompiledNetwork():
+	_hasLazyInputs(false),
+	_compiled(false),
+	_graphRevision(0){
+}
+
+void CompiledNetwork::clear(){
+	_targetIds.clear();
+	_targets.clear();
+	_steps.clear();
+	_tasks.clear();
+	_passiveAttributes.clear();
+	_plans.clear();
+	_hasLazyInputs = false;
+	_compiled = false;
+}
+
+int CompiledNetwork::size(){
+	return _steps.size();
+}
+
+bool CompiledNetwork::isValid(){
+	// plans are not rebuilt while batch editing, the graph may not match them anymore
+	return _compiled && _graphRevision == NetworkManager::graphRevision() && !NetworkManager::isBatchEditing();
+}
+
+void CompiledNetwork::collectOutputs(Node *node, std::vector<Attribute*> &outputs){
+	const std::vector<Attribute*> &nodeOutputs = node->outputAttributes();
+	outputs.insert(outputs.end(), nodeOutputs.begin(), nodeOutputs.end());
+	
+	std::vector<Node*> nodes = node->nodes();
+	for(int i = 0; i < nodes.size(); ++i){
+		collectOutputs(nodes[i], outputs);
+	}
+}
+
+void CompiledNetwork::compile(Node *node){
+	std::vector<Attribute*> outputs = node->outputAttributes();
+	if(outputs.empty()){
+		collectOutputs(node, outputs);
+	}
+	
+	compile(outputs);
+}
+
+void CompiledNetwork::compile(const std::vector<Attribute*> &attributes){
+	clear();
+	
+	_targets = attributes;
+	for(int i = 0; i < _targets.size(); ++i){
+		_targetIds.push_back(_targets[i]->id());
+	}
+	
+	if(NetworkManager::isBatchEditing()){
+		// plans will be rebuilt once the batch is over, run() falls back to the regular engine meanwhile
+		return;
+	}
+	
+	// the whole upstream, unlike Attribute::collectDirtyUpstream() clean attributes are collected too
+	unsigned int visitStamp = Attribute::newVisitStamp();
+	
+	std::vector<Attribute*> upstream;
+	for(int i = 0; i < _targets.size(); ++i){
+		Attribute *target = _targets[i];
+		if(target->_visitStamp != visitStamp){
+			target->_visitStamp = visitStamp;
+			upstream.push_back(target);
+		}
+	}
+	
+	for(int i = 0; i < upstream.size(); ++i){
+		Attribute *attr = upstream[i];
+		
+		Attribute *input = attr->_input;
+		if(input && input->_visitStamp != visitStamp){
+			input->_visitStamp = visitStamp;
+			upstream.push_back(input);
+		}
+		
+		for(int j = 0; j < attr->_affectedBy.size(); ++j){
+			Attribute *affectedBy = attr->_affectedBy[j];
+			if(affectedBy->_isLazy){
+				_hasLazyInputs = true;
+			}
+			else if(affectedBy->_visitStamp != visitStamp){
+				affectedBy->_visitStamp = visitStamp;
+				upstream.push_back(affectedBy);
+			}
+		}
+	}
+	
+	// attributes of networks that are not connected to each other belong to different plans, 
+	// each plan is laid out in its own evaluation order.
+	std::map<EvaluationPlan*, std::vector<std::pair<int, Attribute*> > > attributesByPlan;
+	for(int i = 0; i < upstream.size(); ++i){
+		Attribute *attr = upstream[i];
+		if(!attr->_evaluationPlan){
+			EvaluationPlan::build(attr);
+		}
+		
+		EvaluationPlan *plan = attr->_evaluationPlan.get();
+		std::vector<std::pair<int, Attribute*> > &planAttributes = attributesByPlan[plan];
+		if(planAttributes.empty()){
+			_plans.push_back(attr->_evaluationPlan);
+		}
+		
+		planAttributes.push_back(std::make_pair(attr->_planIndex, attr));
+	}
+	
+	for(int i = 0; i < _plans.size(); ++i){
+		EvaluationPlan *plan = _plans[i].get();
+		std::vector<std::pair<int, Attribute*> > &planAttributes = attributesByPlan[plan];
+		std::sort(planAttributes.begin(), planAttributes.end());
+		
+		std::vector<Attribute*> tasks;
+		for(int j = 0; j < planAttributes.size(); ++j){
+			Attribute *attr = planAttributes[j].second;
+			if(EvaluationPlan::isTask(attr)){
+				tasks.push_back(attr);
+			}
+			else{
+				_passiveAttributes.push_back(attr);
+			}
+		}
+		
+		std::vector<std::vector<Attribute*> > taskGroups;
+		plan->groupTasks(tasks, taskGroups);
+		
+		for(int j = 0; j < taskGroups.size(); ++j){
+			Node *parentNode = taskGroups[j][0]->parent();
+			if(parentNode){
+				Step step;
+				step.node = parentNode;
+				step.outputs = taskGroups[j];
+				_steps.push_back(step);
+			}
+		}
+		
+		_tasks.insert(_tasks.end(), tasks.begin(), tasks.end());
+	}
+	
+	_graphRevision = NetworkManager::graphRevision();
+	_compiled = true;
+}
+
+void CompiledNetwork::fallback(){
+	std::vector<Attribute*> targets;
+	for(int i = 0; i < _targetIds.size(); ++i){
+		Attribute *target = (Attribute*)NetworkManager::findObjectById(_targetIds[i]);
+		if(target){
+			targets.push_back(target);
+		}
+	}
+	
+	Attribute::clean(targets);
+}
+
+void CompiledNetwork::run(){
+	if(!isValid()){
+		fallback();
+		return;
+	}
+	
+	bool dirty = false;
+	for(int i = 0; i < _targets.size() && !dirty; ++i){
+		dirty = _targets[i]->isClean() == false;
+	}
+	
+	if(!dirty){
+		return;
+	}
+	
+	for(int i = 0; i < _plans.size(); ++i){
+		if(_plans[i]->context()->isEvaluating()){
+			// started by a node being updated, nested evaluations are left to the regular engine
+			fallback();
+			return;
+		}
+	}
+	
+	for(int i = 0; i < _plans.size(); ++i){
+		_plans[i]->context()->setIsEvaluating(true);
+	}
+	
+	ProfilerScope profilerScope(Profiler::spanTypeEvaluation, _targets[0]);
+	unsigned int epoch = Attribute::newEvaluationEpoch();
+	
+	// while the contexts are evaluating, inputs read by the nodes return their value as it is, 
+	// the updates feeding them were already done by the previous steps.
+	// each step honours the same cancellation and early cutoff as Attribute::cleanSelf(), 
+	// steps skipped once cancelled leave their outputs dirty.
+	for(int i = 0; i < _steps.size(); ++i){
+		Step &step = _steps[i];
+		
+		EvaluationContext *context = step.outputs[0]->evaluationContext();
+		if(context->isCancelled()){
+			continue;
+		}
+		
+		std::vector<Attribute*> outputs;
+		for(int j = 0; j < step.outputs.size(); ++j){
+			Attribute *output = step.outputs[j];
+			if(output->isClean() == false){
+				output->_cleanEpoch = epoch;
+				
+				if(step.node->updateEnabled() && output->needsUpdate()){
+					outputs.push_back(output);
+				}
+			}
+		}
+		
+		if(outputs.empty()){
+			continue;
+		}
+		
+		if(step.node->updateOutputsTogether()){
+			step.node->doUpdate(outputs);
+		}
+		else{
+			step.node->doUpdate(outputs[0]);
+		}
+		
+		// cancelled halfway through its slices
+		if(step.node->_slicer && context->isCancelled()){
+			for(int j = 0; j < outputs.size(); ++j){
+				outputs[j]->setIsClean(false);
+			}
+			
+			continue;
+		}
+		
+		for(int j = 0; j < outputs.size(); ++j){
+			Attribute *output = outputs[j];
+			output->_computedEpoch = epoch;
+			output->_computeCount++;
+			output->updateChangedEpoch();
+		}
+		
+		context->nodeUpdated(step.node);
+	}
+	
+	// same as Attribute::evaluate(), inputs and passThroughs fed by an output left dirty by its node stay dirty
+	for(int i = 0; i < _passiveAttributes.size(); ++i){
+		Attribute *attr = _passiveAttributes[i];
+		if(attr->_input == 0 || attr->_input->isClean()){
+			attr->_cleanEpoch = epoch;
+		}
+		else{
+			attr->_cleanEpoch = attr->_dirtyEpoch;
+		}
+	}
+	
+	if(_hasLazyInputs){
+		Attribute::markUnreadLazyInputs(_tasks);
+	}
+	
+	for(int i = 0; i < _plans.size(); ++i){
+		_plans[i]->context()->setIsEvaluating(false);
+	}
+}
@@ -0,0 +1,92 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+#ifndef CORAL_COMPILEDNETWORK_H
+#define CORAL_COMPILEDNETWORK_H
+
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include "coralDefinitions.h"
+
+namespace coral{
+class Node;
+class Attribute;
+class EvaluationPlan;
+
+//! A network frozen into a flat list of node updates, to play it back with as little bookkeeping as possible.
+//
+//! compile() walks the whole upstream of the given attributes once and stores, in evaluation order, the node updates they need 
+//! and the inputs and passThroughs to mark clean once the updates are done.
+//! run() then goes through the list without collecting the dirty upstream, sorting or grouping tasks, updates whose outputs are clean are skipped.
+//! Any edit to the structure of the graph, see NetworkManager::graphRevision(), makes the compiled network invalid: 
+//! run() then falls back to Attribute::clean() until compile() is called again.
+//! Branches behind lazy inputs are left out, they are evaluated by the regular engine when their node reads them.
+//! Updates run one after the other, nodes nested in a slicer still process their slices concurrently.
+class CORAL_EXPORT CompiledNetwork{
+public:
+	CompiledNetwork();
+	
+	//! Compiles the evaluation of the given attributes.
+	void compile(const std::vector<Attribute*> &attributes);
+	
+	//! Compiles the evaluation of the outputs of node, or of all the outputs found under it if it has none of its own, such as the root node.
+	void compile(Node *node);
+	
+	//! False until compile() is called and again once the graph is edited.
+	bool isValid();
+	
+	//! Cleans the compiled attributes, so that their values can be read.
+	void run();
+	
+	//! The number of node updates in the compiled network.
+	int size();
+	void clear();
+
+private:
+	struct Step{
+		Node *node;
+		std::vector<Attribute*> outputs;
+	};
+	
+	std::vector<int> _targetIds;
+	std::vector<Attribute*> _targets;
+	std::vector<Step> _steps;
+	std::vector<Attribute*> _tasks;
+	std::vector<Attribute*> _passiveAttributes;
+	std::vector<boost::shared_ptr<EvaluationPlan> > _plans;
+	bool _hasLazyInputs;
+	bool _compiled;
+	unsigned int _graphRevision;
+	
+	void collectOutputs(Node *node, std::vector<Attribute*> &outputs);
+	void fallback();
+};
+
+}
+
+#endif
@@ -0,0 +1,108 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+#include "EvaluationContext.h"
+#include "AsyncEvaluation.h"
+#include "Node.h"
+
+using namespace coral;
+
+EvaluationContext::EvaluationContext(){
+	_evaluating = false;
+	
+	#ifdef CORAL_PARALLEL_TBB
+		_asyncEvaluating = false;
+		_cancelled = false;
+		_updatesPlanned = 0;
+		_updatesDone = 0;
+		_lastUpdatedNodeId = 0;
+	#endif
+}
+
+bool EvaluationContext::isEvaluating(){
+	return _evaluating;
+}
+
+void EvaluationContext::setIsEvaluating(bool value){
+	_evaluating = value;
+}
+
+void EvaluationContext::queueDirtyingDoneCallback(void(*callback)(Attribute *)){
+	#ifdef CORAL_PARALLEL_TBB
+		tbb::mutex::scoped_lock lock(_callbacksMutex);
+	#endif
+	
+	_dirtyingDoneCallbacks.push_back(callback);
+}
+
+void EvaluationContext::processDirtyingDoneCallbacks(Attribute *attribute){
+	std::vector<void(*)(Attribute *)> callbacks;
+	
+	{
+		#ifdef CORAL_PARALLEL_TBB
+			tbb::mutex::scoped_lock lock(_callbacksMutex);
+		#endif
+		
+		callbacks.swap(_dirtyingDoneCallbacks);
+	}
+	
+	for(int i = 0; i < callbacks.size(); ++i){
+		callbacks[i](attribute);
+	}
+}
+
+bool EvaluationContext::isCancelled(){
+	#ifdef CORAL_PARALLEL_TBB
+		return _cancelled;
+	#else
+		return false;
+	#endif
+}
+
+void EvaluationContext::updatesPlanned(int count){
+	#ifdef CORAL_PARALLEL_TBB
+		if(_asyncEvaluating){
+			_updatesPlanned += count;
+		}
+	#endif
+}
+
+void EvaluationContext::nodeUpdated(Node *node){
+	#ifdef CORAL_PARALLEL_TBB
+		if(_asyncEvaluating){
+			_updatesDone++;
+			_lastUpdatedNodeId = node->id();
+		}
+	#endif
+}
+
+#ifdef CORAL_PARALLEL_TBB
+tbb::recursive_mutex &EvaluationContext::lazyEvaluationMutex(){
+	return _lazyEvaluationMutex;
+}
+#endif
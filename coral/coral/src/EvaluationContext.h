@@ -0,0 +1,108 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+#ifndef CORAL_EVALUATIONCONTEXT_H
+#define CORAL_EVALUATIONCONTEXT_H
+
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include "coralDefinitions.h"
+
+#ifdef CORAL_PARALLEL_TBB
+	#include <tbb/mutex.h>
+	#include <tbb/recursive_mutex.h>
+	#include <tbb/atomic.h>
+	#include <tbb/tbb_thread.h>
+#endif
+
+namespace coral{
+class Attribute;
+class Node;
+class AsyncEvaluation;
+
+//! The state of the evaluations running on a group of connected attributes.
+//
+//! Each EvaluationPlan owns a context, so networks that are not connected to each other can be dirtied and cleaned 
+//! from different threads at the same time. Evaluations of the same group are not meant to be started concurrently, 
+//! the context only tells whether one is already in progress: attributes read by the nodes being updated must not start another one.
+class CORAL_EXPORT EvaluationContext{
+public:
+	EvaluationContext();
+	
+	//! True while one of the attributes of the group is being cleaned.
+	bool isEvaluating();
+	void setIsEvaluating(bool value);
+	
+	//! Queues a callback to be invoked once the dirty pass in progress on this context is done.
+	void queueDirtyingDoneCallback(void(*callback)(Attribute *));
+	
+	//! Invokes and clears the callbacks queued so far.
+	void processDirtyingDoneCallbacks(Attribute *attribute);
+	
+	//! True once the asynchronous evaluation running on this group was cancelled, see AsyncEvaluation.
+	//! Attributes are not computed anymore and nodes stop between slices, leaving their outputs dirty.
+	bool isCancelled();
+	
+	//! Count the node updates of an asynchronous evaluation to report its progress, they do nothing otherwise.
+	void updatesPlanned(int count);
+	void nodeUpdated(Node *node);
+	
+	#ifdef CORAL_PARALLEL_TBB
+		//! Serializes the evaluations of lazy inputs started by the nodes of this group, see Node::setAttributeIsLazy().
+		tbb::recursive_mutex &lazyEvaluationMutex();
+	#endif
+
+private:
+	friend class AsyncEvaluation;
+	
+	std::vector<void(*)(Attribute *)> _dirtyingDoneCallbacks;
+	
+	#ifdef CORAL_PARALLEL_TBB
+		tbb::atomic<bool> _evaluating;
+		tbb::mutex _callbacksMutex;
+		tbb::recursive_mutex _lazyEvaluationMutex;
+		
+		tbb::mutex _asyncMutex;
+		boost::shared_ptr<AsyncEvaluation> _asyncEvaluation;
+		tbb::tbb_thread::id _asyncRequester;
+		tbb::atomic<bool> _asyncEvaluating;
+		tbb::atomic<bool> _cancelled;
+		tbb::atomic<int> _updatesPlanned;
+		tbb::atomic<int> _updatesDone;
+		tbb::atomic<int> _lastUpdatedNodeId;
+	#else
+		bool _evaluating;
+	#endif
+	
+	EvaluationContext(const EvaluationContext &other);
+	EvaluationContext &operator =(const EvaluationContext &other);
+};
+
+}
+
+#endif
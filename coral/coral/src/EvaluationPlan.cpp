@@ -0,0 +1,292 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+#include <map>
+#include <algorithm>
+#include <boost/shared_ptr.hpp>
+
+#include "EvaluationPlan.h"
+#include "EvaluationContext.h"
+#include "Attribute.h"
+#include "Node.h"
+#include "containerUtils.h"
+
+using namespace coral;
+
+namespace {
+	void collectNeighbours(Attribute *attribute, std::vector<Attribute*> &neighbours){
+		neighbours.clear();
+		
+		if(attribute->input()){
+			neighbours.push_back(attribute->input());
+		}
+		
+		const std::vector<Attribute*> &outputs = attribute->outputs();
+		neighbours.insert(neighbours.end(), outputs.begin(), outputs.end());
+		
+		const std::vector<Attribute*> &affect = attribute->affecting();
+		neighbours.insert(neighbours.end(), affect.begin(), affect.end());
+		
+		const std::vector<Attribute*> &affectedBy = attribute->affectedBy();
+		neighbours.insert(neighbours.end(), affectedBy.begin(), affectedBy.end());
+	}
+}
+
+bool EvaluationPlan::isTask(Attribute *attribute){
+	return attribute->isOutput();
+}
+
+int EvaluationPlan::size(){
+	return _levels.size();
+}
+
+EvaluationContext *EvaluationPlan::context(){
+	return _context.get();
+}
+
+int EvaluationPlan::levelAt(int index){
+	return _levels[index];
+}
+
+const std::vector<int> &EvaluationPlan::predecessorTasksAt(int index){
+	return _predecessorTasks[index];
+}
+
+bool EvaluationPlan::isAnimatedAt(int index){
+	return _animated[index];
+}
+
+void EvaluationPlan::groupTasks(const std::vector<Attribute*> &tasks, std::vector<std::vector<Attribute*> > &taskGroups){
+	taskGroups.clear();
+	
+	// sorting by level is a valid evaluation order too, every predecessor of a task sits on a lower level.
+	std::vector<std::pair<std::pair<int, int>, Attribute*> > sortedTasks(tasks.size());
+	for(int i = 0; i < tasks.size(); ++i){
+		Attribute *task = tasks[i];
+		sortedTasks[i] = std::make_pair(std::make_pair(_levels[task->_planIndex], task->_planIndex), task);
+	}
+	std::sort(sortedTasks.begin(), sortedTasks.end());
+	
+	std::map<std::pair<Node*, int>, int> groupByNodeLevel;
+	for(int i = 0; i < sortedTasks.size(); ++i){
+		Attribute *task = sortedTasks[i].second;
+		
+		Node *parentNode = task->parent();
+		if(parentNode && parentNode->updateOutputsTogether()){
+			std::pair<Node*, int> nodeLevel(parentNode, sortedTasks[i].first.first);
+			
+			std::map<std::pair<Node*, int>, int>::iterator it = groupByNodeLevel.find(nodeLevel);
+			if(it != groupByNodeLevel.end()){
+				taskGroups[it->second].push_back(task);
+				continue;
+			}
+			
+			groupByNodeLevel[nodeLevel] = taskGroups.size();
+		}
+		
+		taskGroups.push_back(std::vector<Attribute*>(1, task));
+	}
+}
+
+void EvaluationPlan::collectCleanTasks(const std::vector<std::vector<Attribute*> > &taskGroups, std::vector<CleanTask> &cleanTasks){
+	int groupsSize = taskGroups.size();
+	cleanTasks.resize(groupsSize);
+	
+	// plan index of each task paired with the index of its group, sorted for lookups
+	std::vector<std::pair<int, int> > groupByPlanIndex;
+	for(int i = 0; i < groupsSize; ++i){
+		for(int j = 0; j < taskGroups[i].size(); ++j){
+			groupByPlanIndex.push_back(std::make_pair(taskGroups[i][j]->_planIndex, i));
+		}
+	}
+	std::sort(groupByPlanIndex.begin(), groupByPlanIndex.end());
+	
+	std::map<Node*, int> lastTaskByNode;
+	for(int i = 0; i < groupsSize; ++i){
+		const std::vector<Attribute*> &taskGroup = taskGroups[i];
+		CleanTask &cleanTask = cleanTasks[i];
+		cleanTask.attributes = taskGroup;
+		cleanTask.predecessors = 0;
+		cleanTask.successors.clear();
+		
+		// predecessors that are clean already are not part of this evaluation, 
+		// the ones that are always come in an earlier group.
+		for(int j = 0; j < taskGroup.size(); ++j){
+			const std::vector<int> &predecessorTasks = _predecessorTasks[taskGroup[j]->_planIndex];
+			for(int k = 0; k < predecessorTasks.size(); ++k){
+				std::vector<std::pair<int, int> >::iterator it = std::lower_bound(groupByPlanIndex.begin(), groupByPlanIndex.end(), std::make_pair(predecessorTasks[k], -1));
+				if(it != groupByPlanIndex.end() && it->first == predecessorTasks[k]){
+					std::vector<int> &successors = cleanTasks[it->second].successors;
+					if(successors.empty() || successors.back() != i){
+						successors.push_back(i);
+						cleanTask.predecessors++;
+					}
+				}
+			}
+		}
+		
+		Node *parentNode = taskGroup[0]->parent();
+		if(parentNode){
+			std::map<Node*, int>::iterator lastTaskIt = lastTaskByNode.find(parentNode);
+			if(lastTaskIt != lastTaskByNode.end()){
+				std::vector<int> &successors = cleanTasks[lastTaskIt->second].successors;
+				if(successors.empty() || successors.back() != i){
+					successors.push_back(i);
+					cleanTask.predecessors++;
+				}
+			}
+			
+			lastTaskByNode[parentNode] = i;
+		}
+	}
+}
+
+void EvaluationPlan::build(Attribute *attribute){
+	// collect the whole group of attributes linked to this one
+	unsigned int visitStamp = Attribute::newVisitStamp();
+	
+	std::vector<Attribute*> group(1, attribute);
+	attribute->_visitStamp = visitStamp;
+	
+	std::vector<Attribute*> neighbours;
+	for(int i = 0; i < group.size(); ++i){
+		collectNeighbours(group[i], neighbours);
+		
+		for(int j = 0; j < neighbours.size(); ++j){
+			Attribute *neighbour = neighbours[j];
+			if(neighbour->_visitStamp != visitStamp){
+				neighbour->_visitStamp = visitStamp;
+				group.push_back(neighbour);
+			}
+		}
+	}
+	
+	// sort the group topologically, _planIndex temporarily holds the position in the group
+	int groupSize = group.size();
+	std::vector<int> pendingInputs(groupSize);
+	std::vector<Attribute*> sorted;
+	sorted.reserve(groupSize);
+	
+	for(int i = 0; i < groupSize; ++i){
+		Attribute *attr = group[i];
+		attr->_planIndex = i;
+		
+		pendingInputs[i] = attr->affectedBy().size();
+		if(attr->input()){
+			pendingInputs[i]++;
+		}
+		
+		if(pendingInputs[i] == 0){
+			sorted.push_back(attr);
+		}
+	}
+	
+	for(int i = 0; i < sorted.size(); ++i){
+		Attribute *attr = sorted[i];
+		
+		const std::vector<Attribute*> &outputs = attr->outputs();
+		for(int j = 0; j < outputs.size(); ++j){
+			if(--pendingInputs[outputs[j]->_planIndex] == 0){
+				sorted.push_back(outputs[j]);
+			}
+		}
+		
+		const std::vector<Attribute*> &affect = attr->affecting();
+		for(int j = 0; j < affect.size(); ++j){
+			if(--pendingInputs[affect[j]->_planIndex] == 0){
+				sorted.push_back(affect[j]);
+			}
+		}
+	}
+	
+	if(sorted.size() != groupSize){
+		// connections are validated against cycles so this should never happen, 
+		// the attributes left over are appended as they come so that the plan still covers the whole group.
+		for(int i = 0; i < groupSize; ++i){
+			if(pendingInputs[i] > 0){
+				sorted.push_back(group[i]);
+			}
+		}
+	}
+	
+	for(int i = 0; i < groupSize; ++i){
+		sorted[i]->_planIndex = i;
+	}
+	
+	// levels, nearest upstream tasks and animated attributes
+	boost::shared_ptr<EvaluationPlan> plan(new EvaluationPlan());
+	plan->_levels.resize(groupSize, 0);
+	plan->_predecessorTasks.resize(groupSize);
+	plan->_animated.resize(groupSize, false);
+	
+	// a plan rebuilt while its group is being cleaned keeps the context of the evaluation in progress
+	if(attribute->_evaluationPlan && attribute->_evaluationPlan->_context->isEvaluating()){
+		plan->_context = attribute->_evaluationPlan->_context;
+	}
+	else{
+		plan->_context = boost::shared_ptr<EvaluationContext>(new EvaluationContext());
+	}
+	
+	for(int i = 0; i < groupSize; ++i){
+		Attribute *attr = sorted[i];
+		int &level = plan->_levels[i];
+		std::vector<int> &predecessorTasks = plan->_predecessorTasks[i];
+		bool animated = attr->_isAnimatedSource;
+		
+		std::vector<Attribute*> inputs = attr->affectedBy();
+		if(attr->input()){
+			inputs.push_back(attr->input());
+		}
+		
+		for(int j = 0; j < inputs.size(); ++j){
+			int inputIndex = inputs[j]->_planIndex;
+			level = std::max(level, plan->_levels[inputIndex] + 1);
+			animated = animated || plan->_animated[inputIndex];
+			
+			if(isTask(inputs[j])){
+				containerUtils::addUniqueElementInContainer(inputIndex, predecessorTasks);
+			}
+			else{
+				const std::vector<int> &inputPredecessors = plan->_predecessorTasks[inputIndex];
+				for(int k = 0; k < inputPredecessors.size(); ++k){
+					containerUtils::addUniqueElementInContainer(inputPredecessors[k], predecessorTasks);
+				}
+			}
+		}
+		
+		plan->_animated[i] = animated;
+	}
+	
+	for(int i = 0; i < groupSize; ++i){
+		if(!isTask(sorted[i])){
+			std::vector<int>().swap(plan->_predecessorTasks[i]);
+		}
+		
+		sorted[i]->_evaluationPlan = plan;
+	}
+}
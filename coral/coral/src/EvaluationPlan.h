@@ -0,0 +1,88 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+
+#ifndef CORAL_EVALUATIONPLAN_H
+#define CORAL_EVALUATIONPLAN_H
+
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include "coralDefinitions.h"
+
+namespace coral{
+class Attribute;
+class EvaluationContext;
+struct CleanTask;
+
+//! The evaluation order of a group of connected attributes.
+//
+//! A plan is computed once for each group of attributes linked by connections or affects, and it's shared by all of them:
+//! each attribute only keeps its index in the plan.
+//! Plans are rebuilt by Attribute::cacheEvaluationChain() whenever the connections of the group change.
+class CORAL_EXPORT EvaluationPlan{
+public:
+	//! Builds a new plan for the group of attributes connected to attribute and assigns it to each one of them.
+	static void build(Attribute *attribute);
+	
+	//! Returns true if attribute gets computed by its parent node rather than receiving its value from an input.
+	static bool isTask(Attribute *attribute);
+	
+	int size();
+	
+	//! The context of the evaluations running on this group.
+	EvaluationContext *context();
+	
+	//! The number of connections on the longest path going from a source of the plan to the attribute at index.
+	int levelAt(int index);
+	
+	//! The indices of the nearest tasks upstream of the attribute at index, 
+	//! the attribute can only be computed once all of them are clean.
+	const std::vector<int> &predecessorTasksAt(int index);
+	
+	//! True if the attribute at index is an animated source, see Node::setAttributeIsAnimated(), or if one is found upstream of it.
+	bool isAnimatedAt(int index);
+	
+	//! Splits the tasks being cleaned together into groups sorted in evaluation order, tasks must be sorted by their index in this plan.
+	//! Each group holds a single task, except for nodes declared as Node::setUpdateOutputsTogether(true): 
+	//! their tasks sharing the same level can't depend on each other and are grouped to be computed by one update.
+	void groupTasks(const std::vector<Attribute*> &tasks, std::vector<std::vector<Attribute*> > &taskGroups);
+	
+	//! Builds the dependency graph between the task groups returned by groupTasks().
+	//! Groups belonging to the same node are chained, a node never computes two of its outputs at the same time.
+	void collectCleanTasks(const std::vector<std::vector<Attribute*> > &taskGroups, std::vector<CleanTask> &cleanTasks);
+
+private:
+	std::vector<int> _levels;
+	std::vector<std::vector<int> > _predecessorTasks;
+	std::vector<bool> _animated;
+	boost::shared_ptr<EvaluationContext> _context;
+};
+
+}
+
+#endif
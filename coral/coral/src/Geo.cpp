@@ -121,7 +121,15 @@ void Geo::setPoints(const std::vector<Imath::V3f> &points){
 
 // Will displace the points of this geo without modifying the size of the array.
 void Geo::displacePoints(const std::vector<Imath::V3f> &displacedPoints){
-	int displacedPointsSize = displacedPoints.size();
+	if(displacedPoints.size()){
+		displacePoints(&displacedPoints[0], displacedPoints.size());
+	}
+	else{
+		displacePoints(0, 0);
+	}
+}
+
+void Geo::displacePoints(const Imath::V3f *displacedPoints, unsigned int displacedPointsSize){
 	int pointsSize = _points.size();
 	int minSize;
 	
@@ -464,3 +472,24 @@ const std::vector<Face*> &Geo::faces(){
 	
 	return _facesPtr;
 }
+
+std::size_t Geo::sizeInBytes(){
+	std::size_t size = _rawFaces.capacity() * sizeof(std::vector<int>);
+	for(int i = 0; i < _rawFaces.size(); ++i){
+		size += _rawFaces[i].capacity() * sizeof(int);
+	}
+	
+	size += _vertexFaces.capacity() * sizeof(std::vector<int>);
+	for(int i = 0; i < _vertexFaces.size(); ++i){
+		size += _vertexFaces[i].capacity() * sizeof(int);
+	}
+	
+	size += _faces.capacity() * sizeof(Face) + _facesPtr.capacity() * sizeof(Face*);
+	size += _vertices.capacity() * sizeof(Vertex) + _verticesPtr.capacity() * sizeof(Vertex*);
+	size += _edgesMap.size() * sizeof(std::pair<std::pair<int, int>, Edge>) + _edges.capacity() * sizeof(Edge*);
+	size += (_points.capacity() + _faceNormals.capacity() + _verticesNormals.capacity()) * sizeof(Imath::V3f);
+	size += _rawUvs.capacity() * sizeof(Imath::V2f);
+	size += (_rawIndices.capacity() + _rawIndexCounts.capacity() + _vertexIdOffset.capacity()) * sizeof(int);
+	
+	return size;
+}
@@ -200,8 +200,12 @@ public:
 	void setVerticesNormals(const std::vector<Imath::V3f> &normals);
 	void setPoints(const std::vector<Imath::V3f> &points);
 	void displacePoints(const std::vector<Imath::V3f> &displacedPoints);
+	
+	//! Same as above, for points held elsewhere than in a std::vector, such as an array mapped from a file.
+	void displacePoints(const Imath::V3f *displacedPoints, unsigned int displacedPointsSize);
 	bool hasSameTopology(const std::vector<std::vector<int> > &faces) const;
 	void clear();
+	std::size_t sizeInBytes();
 	const std::vector<Vertex*> &vertices();
 	const std::vector<Edge*> &edges();
 	const std::vector<Face*> &faces();
@@ -0,0 +1,230 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+#include <vector>
+
+#include "MappedFile.h"
+
+#if defined(WIN64) || defined(_WIN64) || defined(WIN32) || defined(_WIN32)
+	#define CORAL_MAPPEDFILE_WINDOWS
+	#define WIN32_LEAN_AND_MEAN
+	#include <windows.h>
+#else
+	#include <stdlib.h>
+	#include <string.h>
+	#include <unistd.h>
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+using namespace coral;
+
+MappedFile::MappedFile(const std::string &path, Mode mode, std::size_t bytes):
+	_path(path),
+	_mode(mode),
+	_data(0),
+	_size(0),
+	_isValid(false){
+	
+	#ifdef CORAL_MAPPEDFILE_WINDOWS
+	_fileHandle = INVALID_HANDLE_VALUE;
+	_mappingHandle = 0;
+	
+	if(mode == modeRead){
+		_fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0);
+	}
+	else{
+		char filename[MAX_PATH];
+		if(GetTempFileNameA(path.c_str(), "crl", 0, filename)){
+			_path = filename;
+			_fileHandle = CreateFileA(filename, GENERIC_READ | GENERIC_WRITE, 0, 0, CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, 0);
+		}
+	}
+	
+	if(_fileHandle == INVALID_HANDLE_VALUE){
+		return;
+	}
+	
+	if(mode == modeRead){
+		LARGE_INTEGER fileSize;
+		GetFileSizeEx(_fileHandle, &fileSize);
+		_size = std::size_t(fileSize.QuadPart);
+	}
+	else{
+		_size = bytes;
+	}
+	#else
+	if(mode == modeRead){
+		_fileDescriptor = open(path.c_str(), O_RDONLY);
+	}
+	else{
+		// the file is unlinked right away, it lives as long as it's open
+		std::string filename = path + "/coralScratchXXXXXX";
+		std::vector<char> filenameBuffer(filename.begin(), filename.end());
+		filenameBuffer.push_back('\0');
+		
+		_fileDescriptor = mkstemp(&filenameBuffer[0]);
+		if(_fileDescriptor != -1){
+			_path = &filenameBuffer[0];
+			unlink(&filenameBuffer[0]);
+		}
+	}
+	
+	if(_fileDescriptor == -1){
+		return;
+	}
+	
+	if(mode == modeRead){
+		struct stat fileStat;
+		if(fstat(_fileDescriptor, &fileStat) != 0){
+			return;
+		}
+		
+		_size = std::size_t(fileStat.st_size);
+	}
+	else{
+		_size = bytes;
+	}
+	#endif
+	
+	_isValid = map();
+}
+
+MappedFile::~MappedFile(){
+	unmap();
+	
+	#ifdef CORAL_MAPPEDFILE_WINDOWS
+	if(_fileHandle != INVALID_HANDLE_VALUE){
+		CloseHandle(_fileHandle);
+	}
+	#else
+	if(_fileDescriptor != -1){
+		close(_fileDescriptor);
+	}
+	#endif
+}
+
+bool MappedFile::isValid(){
+	return _isValid;
+}
+
+bool MappedFile::isWritable(){
+	return _mode == modeScratch;
+}
+
+const std::string &MappedFile::path(){
+	return _path;
+}
+
+char *MappedFile::data(){
+	return _data;
+}
+
+std::size_t MappedFile::size(){
+	return _size;
+}
+
+bool MappedFile::resize(std::size_t bytes){
+	if(!_isValid || _mode != modeScratch){
+		return false;
+	}
+	
+	if(bytes != _size){
+		unmap();
+		_size = bytes;
+		_isValid = map();
+	}
+	
+	return _isValid;
+}
+
+bool MappedFile::map(){
+	if(_size == 0){
+		return true;
+	}
+	
+	#ifdef CORAL_MAPPEDFILE_WINDOWS
+	DWORD sizeHigh = DWORD((unsigned long long)(_size) >> 32);
+	DWORD sizeLow = DWORD(_size & 0xffffffff);
+	
+	if(_mode == modeRead){
+		_mappingHandle = CreateFileMappingA(_fileHandle, 0, PAGE_READONLY, 0, 0, 0);
+	}
+	else{
+		// the mapping grows the file to the requested size
+		_mappingHandle = CreateFileMappingA(_fileHandle, 0, PAGE_READWRITE, sizeHigh, sizeLow, 0);
+	}
+	
+	if(!_mappingHandle){
+		return false;
+	}
+	
+	_data = (char*)MapViewOfFile(_mappingHandle, _mode == modeRead ? FILE_MAP_READ : FILE_MAP_WRITE, 0, 0, _size);
+	#else
+	if(_mode == modeScratch && ftruncate(_fileDescriptor, _size) != 0){
+		return false;
+	}
+	
+	int protection = PROT_READ;
+	if(_mode == modeScratch){
+		protection |= PROT_WRITE;
+	}
+	
+	void *data = mmap(0, _size, protection, MAP_SHARED, _fileDescriptor, 0);
+	if(data == MAP_FAILED){
+		return false;
+	}
+	
+	// values are mostly walked from first to last, let the system read ahead and drop the pages left behind
+	madvise(data, _size, MADV_SEQUENTIAL);
+	
+	_data = (char*)data;
+	#endif
+	
+	return _data != 0;
+}
+
+void MappedFile::unmap(){
+	#ifdef CORAL_MAPPEDFILE_WINDOWS
+	if(_data){
+		UnmapViewOfFile(_data);
+	}
+	
+	if(_mappingHandle){
+		CloseHandle(_mappingHandle);
+		_mappingHandle = 0;
+	}
+	#else
+	if(_data){
+		munmap(_data, _size);
+	}
+	#endif
+	
+	_data = 0;
+}
@@ -0,0 +1,87 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+#ifndef CORAL_MAPPEDFILE_H
+#define CORAL_MAPPEDFILE_H
+
+#include <string>
+#include "coralDefinitions.h"
+
+namespace coral{
+
+//! A file mapped in memory, its pages are read from disk only when accessed and the system can drop them again when memory runs low.
+//
+//! modeRead maps an existing file read only.
+//! modeScratch creates a temporary file of the given size in the directory passed as path, to be written in place: 
+//! the file is deleted as soon as it gets unmapped and it's only meant to hold values too big for memory.
+//! Check isValid() after construction, the file may not exist or the system may refuse to map it.
+class CORAL_EXPORT MappedFile{
+public:
+	enum Mode{
+		modeRead = 0,
+		modeScratch
+	};
+	
+	MappedFile(const std::string &path, Mode mode, std::size_t bytes = 0);
+	~MappedFile();
+	
+	bool isValid();
+	bool isWritable();
+	const std::string &path();
+	
+	//! 0 if the file is empty.
+	char *data();
+	std::size_t size();
+	
+	//! Only scratch files can be resized, the data is mapped again and may move, the bytes kept are not copied.
+	bool resize(std::size_t bytes);
+
+private:
+	bool map();
+	void unmap();
+	
+	std::string _path;
+	Mode _mode;
+	char *_data;
+	std::size_t _size;
+	bool _isValid;
+	
+	#if defined(WIN64) || defined(_WIN64) || defined(WIN32) || defined(_WIN32)
+	void *_fileHandle;
+	void *_mappingHandle;
+	#else
+	int _fileDescriptor;
+	#endif
+	
+	MappedFile(const MappedFile &other);
+	MappedFile &operator =(const MappedFile &other);
+};
+
+}
+
+#endif
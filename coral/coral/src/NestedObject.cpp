@@ -26,6 +26,10 @@
 // SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // </license>
 
+#ifdef CORAL_PARALLEL_TBB
+	#include <tbb/mutex.h>
+#endif
+
 #include "NestedObject.h"
 #include "NetworkManager.h"
 #include "containerUtils.h"
@@ -34,6 +38,11 @@
 using namespace coral;
 
 namespace{
+	#ifdef CORAL_PARALLEL_TBB
+		// guards the names and the cached full names, fullName() is also called by the worker threads and the profiler
+		tbb::mutex _namesMutex;
+	#endif
+	
 	std::string increaseNameNumber(const std::string &name){
 		std::string newName = name;
 		
@@ -54,13 +63,43 @@ namespace{
 		
 		return newName;
 	}
+	
+	// splits name the same way increaseNameNumber does, returns false if the digits can't be told apart from the base name
+	bool splitNameNumber(const std::string &name, std::string &baseName, int &number){
+		std::string numberStr;
+		for(int i = 0; i < name.size(); ++i){
+			if(isdigit(name[i])){
+				numberStr += name[i];
+			}
+		}
+		
+		baseName = name;
+		number = 0;
+		if(!numberStr.empty()){
+			number = stringUtils::parseInt(numberStr);
+			baseName = stringUtils::replace(name, numberStr, "");
+		}
+		
+		for(int i = 0; i < baseName.size(); ++i){
+			if(isdigit(baseName[i])){
+				return false;
+			}
+		}
+		
+		return true;
+	}
 }
 
 void(*NestedObject::_setNameCallback)(NestedObject *self, const std::string &name) = 0;
 
+// bumped by every rename or reparent, cached full names older than this are rebuilt
+unsigned int NestedObject::_namesStamp = 1;
+
 NestedObject::NestedObject(const std::string &name, NestedObject *parent): 
 	Object(),
-	_parentObject(parent){
+	_parentObject(parent),
+	_duplicateNames(0),
+	_fullNameStamp(0){
 	
 	_name = generateUniqueName(name);
 }
@@ -74,9 +113,30 @@ void NestedObject::setClassName(const std::string &className){
 
 std::string NestedObject::generateUniqueName(const std::string &name){
 	std::string uniqueName = name;
-	if(_parentObject){
-		while(_parentObject->findObject(uniqueName)){
-			uniqueName = increaseNameNumber(uniqueName);
+	if(_parentObject && _parentObject->findObject(uniqueName)){
+		std::string baseName;
+		int number;
+		if(splitNameNumber(name, baseName, number)){
+			// the siblings numbered from 1 to the hint are known to be taken, skip them rather than trying each one
+			int &hint = _parentObject->_nameNumberHints[baseName];
+			bool hintCovered = hint >= number;
+			if(hintCovered){
+				number = hint;
+			}
+			
+			do{
+				number++;
+				uniqueName = baseName + stringUtils::intToString(number);
+			}while(_parentObject->findObject(uniqueName));
+			
+			if(hintCovered){
+				hint = number - 1;
+			}
+		}
+		else{
+			while(_parentObject->findObject(uniqueName)){
+				uniqueName = increaseNameNumber(uniqueName);
+			}
 		}
 	}
 	
@@ -85,7 +145,19 @@ std::string NestedObject::generateUniqueName(const std::string &name){
 
 void NestedObject::setName(const std::string &name){
 	std::string uniqueName = generateUniqueName(name);
-	_name = uniqueName;
+	std::string oldName = _name;
+	{
+		#ifdef CORAL_PARALLEL_TBB
+			tbb::mutex::scoped_lock lock(_namesMutex);
+		#endif
+		
+		_name = uniqueName;
+		_namesStamp++;
+	}
+	
+	if(_parentObject){
+		_parentObject->renameObject(this, oldName);
+	}
 	
 	if(_setNameCallback && !isDeleted()){
 		_setNameCallback(this, _name);
@@ -115,54 +187,147 @@ std::vector<std::string> NestedObject::classNames(){
 }
 
 std::string NestedObject::fullName(){
-	NestedObject *parent = _parentObject;
-	std::string fullName = name();
+	#ifdef CORAL_PARALLEL_TBB
+		tbb::mutex::scoped_lock lock(_namesMutex);
+	#endif
 	
-	while(parent){
-		fullName = parent->name() + std::string(".") + fullName;
+	// copied while the lock is held
+	return cachedFullName();
+}
+
+const std::string &NestedObject::cachedFullName(){
+	if(_fullNameStamp != _namesStamp){
+		if(_parentObject){
+			_fullName = _parentObject->cachedFullName() + std::string(".") + _name;
+		}
+		else{
+			_fullName = _name;
+		}
 		
-		parent = parent->_parentObject;
+		_fullNameStamp = _namesStamp;
 	}
 	
-	return fullName;
+	return _fullName;
 }
 
 void NestedObject::setParentObject(NestedObject *object){
+	#ifdef CORAL_PARALLEL_TBB
+		tbb::mutex::scoped_lock lock(_namesMutex);
+	#endif
+	
 	_parentObject = object;
+	_namesStamp++;
 }
 
 Object *NestedObject::parentObject(){
 	return _parentObject;
 }
 
+bool NestedObject::containsObject(NestedObject *object){
+	if(findObject(object->_name) == object){
+		return true;
+	}
+	
+	if(_duplicateNames > 0){
+		return containerUtils::elementInContainer(object, _objects);
+	}
+	
+	return false;
+}
+
 void NestedObject::addObject(NestedObject *object){
-	if(containerUtils::elementInContainer(object, _objects) == false){
+	if(containsObject(object) == false){
 		_objects.push_back(object);
+		indexObject(object);
 		
 		object->addReference();
 	}
 }
 
 void NestedObject::removeObject(NestedObject *object){
-	if(containerUtils::elementInContainer(object, _objects)){
+	if(containsObject(object)){
 		containerUtils::eraseElementInContainer(object, _objects);
+		unindexObject(object, object->_name);
 
 		object->removeReference();
 	}
 }
 
+void NestedObject::indexObject(NestedObject *object){
+	// names are unique among siblings, unless an object was moved here from another parent, 
+	// in that case the child added first keeps the entry.
+	if(_objectsByName.insert(std::make_pair(object->_name, object)).second == false){
+		_duplicateNames++;
+	}
+}
+
+void NestedObject::unindexObject(NestedObject *object, const std::string &name){
+	boost::unordered_map<std::string, NestedObject*>::iterator it = _objectsByName.find(name);
+	if(it == _objectsByName.end() || it->second != object){
+		_duplicateNames--;
+		return;
+	}
+	
+	_objectsByName.erase(it);
+	
+	if(_duplicateNames > 0){
+		for(std::vector<NestedObject*>::iterator it = _objects.begin(); it != _objects.end(); ++it){
+			NestedObject *sibling = *it;
+			if(sibling != object && sibling->_name == name){
+				_objectsByName[name] = sibling;
+				_duplicateNames--;
+				return;
+			}
+		}
+	}
+	
+	// the name is free again, unique names must start from it next time
+	std::string baseName;
+	int number;
+	if(splitNameNumber(name, baseName, number) && number > 0){
+		boost::unordered_map<std::string, int>::iterator hintIt = _nameNumberHints.find(baseName);
+		if(hintIt != _nameNumberHints.end() && hintIt->second >= number){
+			hintIt->second = number - 1;
+		}
+	}
+}
+
+void NestedObject::renameObject(NestedObject *object, const std::string &oldName){
+	boost::unordered_map<std::string, NestedObject*>::iterator it = _objectsByName.find(oldName);
+	if(it != _objectsByName.end() && it->second == object){
+		unindexObject(object, oldName);
+		indexObject(object);
+	}
+	else if(_duplicateNames > 0 && containerUtils::elementInContainer(object, _objects)){
+		_duplicateNames--;
+		indexObject(object);
+	}
+}
+
 NestedObject *NestedObject::findObject(const std::string &name){
-	NestedObject *foundObject = 0;
+	boost::unordered_map<std::string, NestedObject*>::iterator it = _objectsByName.find(name);
+	if(it != _objectsByName.end()){
+		return it->second;
+	}
 	
-	for(std::vector<NestedObject*>::iterator it = _objects.begin(); it != _objects.end(); ++it){
-		NestedObject *object = *it;
-		if(object->_name == name){
-			foundObject = object;
-			break;
+	return 0;
+}
+
+NestedObject *NestedObject::findObjectByPath(const std::string &path){
+	NestedObject *object = this;
+	
+	std::string::size_type start = 0;
+	while(object){
+		std::string::size_type end = path.find('.', start);
+		if(end == std::string::npos){
+			return object->findObject(path.substr(start));
 		}
+		
+		object = object->findObject(path.substr(start, end - start));
+		start = end + 1;
 	}
 	
-	return foundObject;
+	return 0;
 }
 
 std::vector<NestedObject*> NestedObject::objects(){
@@ -33,6 +33,7 @@
 #include <string>
 #include <vector>
 #include <iostream>
+#include <boost/unordered_map.hpp>
 
 #include "Object.h"
 
@@ -52,9 +53,18 @@ public:
 	bool hasClassName(const std::string &className) const;
 	void setName(const std::string &name);
 	std::string name();
+	
+	//! The dotted path of this object starting from the root, e.g. "root.node1.input".
+	//! The path is cached until this object or one of its parents gets renamed or reparented, 
+	//! the cache is shared under a lock so the name can be asked from any thread.
 	std::string fullName();
 	std::vector<std::string> classNames();
+	
+	//! Returns the child object with the given name, or 0 if there's none. Children are indexed by name, the lookup takes constant time.
 	NestedObject *findObject(const std::string &name);
+	
+	//! Resolves a dotted path relative to this object, e.g. "node1.input" looks for input under the child node1.
+	NestedObject *findObjectByPath(const std::string &path);
 	std::vector<NestedObject*> objects();
 	Object *parentObject();
 	std::vector<NestedObject*> allParentObjects();
@@ -64,6 +74,7 @@ public:
 	
 protected:
 	void setParentObject(NestedObject *object);
+	bool containsObject(NestedObject *object);
 	void addObject(NestedObject *object);
 	void removeObject(NestedObject *object);
 	
@@ -72,12 +83,22 @@ private:
 	std::vector<std::string> _classNames;
 	NestedObject *_parentObject;
 	std::vector<NestedObject*> _objects;
+	boost::unordered_map<std::string, NestedObject*> _objectsByName;
+	int _duplicateNames;
+	boost::unordered_map<std::string, int> _nameNumberHints;
+	std::string _fullName;
+	unsigned int _fullNameStamp;
 	bool _isConstructing;
+	static unsigned int _namesStamp;
 
 	NestedObject();
 	NestedObject(const NestedObject &other);
 	NestedObject &operator =(const NestedObject &other);
 	std::string generateUniqueName(const std::string &name);
+	const std::string &cachedFullName();
+	void indexObject(NestedObject *object);
+	void unindexObject(NestedObject *object, const std::string &name);
+	void renameObject(NestedObject *object, const std::string &oldName);
 };
 }
 #endif
@@ -27,17 +27,13 @@
 // </license>
 
 #include <sys/stat.h>
-
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/graph_traits.hpp>
-#include <boost/graph/subgraph.hpp>
-#include <boost/graph/depth_first_search.hpp>
-#include <boost/graph/reverse_graph.hpp>
-#include <boost/graph/topological_sort.hpp>
+#include <set>
 
 #include "NetworkManager.h"
 #include "Node.h"
 #include "Attribute.h"
+#include "EvaluationPlan.h"
+#include "AsyncEvaluation.h"
 #include "ErrorObject.h"
 #include "containerUtils.h"
 #include "stringUtils.h"
@@ -50,216 +46,175 @@
 
 using namespace coral;
 
-typedef boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS> Graph;
-typedef boost::graph_traits<Graph>::vertex_descriptor GraphVertex;
-
-Graph _graph;
-
-int NetworkManager::_nextAvailableId = 0;
-std::map<int, Object *> NetworkManager::_objectsById;
+std::vector<NetworkManager::ObjectSlot> NetworkManager::_objectSlots;
+std::deque<int> NetworkManager::_freeObjectSlots;
+int NetworkManager::_objectCount = 0;
 std::vector<std::string> NetworkManager::_searchPaths;
+int NetworkManager::_batchEditDepth = 0;
+bool NetworkManager::_earlyCutoff = false;
+unsigned int NetworkManager::_graphRevision = 0;
+std::set<int> NetworkManager::_deferredEvaluationChains;
+std::map<int, bool> NetworkManager::_deferredBranchSpecializations;
+std::vector<std::pair<int, int> > NetworkManager::_deferredConnections;
+std::vector<int> NetworkManager::_failedBatchConnections;
 
 namespace {
+	// an id is made of the slot index in the low bits and the slot generation in the high bits, the sign bit is never used
+	const int slotBits = 22;
+	const int slotMask = (1 << slotBits) - 1;
+	const int generationMask = (1 << (31 - slotBits)) - 1;
+	
+	// freed slots are only reused once this many are waiting, so that all the slots use up their generations at the same pace
+	const int minFreeObjectSlots = 1024;
+	
 	int fileExist(const std::string &filename){
 	  struct stat buffer;
 	  return (stat (filename.data(), &buffer) == 0);
 	}
 }
 
-class DownstreamVisitor : public boost::default_dfs_visitor{
-public:
-	void discover_vertex(GraphVertex v, const Graph& g){
-		Attribute *attr = (Attribute*)NetworkManager::findObjectById(v);
-		
-		collectedAttributes->push_back(attr);
-	}
-	
-	std::vector<Attribute*> *collectedAttributes;
-};
-
-class UpstreamVisitor : public boost::default_dfs_visitor{
-public:
-	void finish_vertex(GraphVertex v, const boost::reverse_graph<Graph>& g){
-		Attribute *attr = (Attribute*)NetworkManager::findObjectById(v);
-		collectedAttributes->push_back(attr);
+void NetworkManager::getStaticAttributes(Node *node, std::vector<Attribute*> &staticAttributes){
+	std::vector<Attribute*> attributes = node->attributes();
+	for(int i = 0; i < attributes.size(); ++i){
+		if(attributes[i]->isAnimated() == false){
+			staticAttributes.push_back(attributes[i]);
+		}
 	}
 	
-	std::vector<Attribute*> *collectedAttributes;
-};
-
-void NetworkManager::getDownstreamChain(Attribute *attribute, std::vector<Attribute*> &downstreamChain){
-	downstreamChain.clear();
-	
-	int nvertices = boost::num_vertices(_graph);
-	
-	if(nvertices){
-		DownstreamVisitor visitor;
-		visitor.collectedAttributes = &downstreamChain;
-		
-
-		std::vector<boost::default_color_type> color_map(nvertices);
-		boost::depth_first_visit(_graph, boost::vertex(attribute->id(), _graph), visitor, 
-			boost::make_iterator_property_map(color_map.begin(), boost::get(boost::vertex_index, _graph), color_map[0]));
+	std::vector<Node*> nodes = node->nodes();
+	for(int i = 0; i < nodes.size(); ++i){
+		getStaticAttributes(nodes[i], staticAttributes);
 	}
 }
 
-void NetworkManager::getUpstreamChain(Attribute *attribute, std::vector<Attribute*> &upstreamChain){
-	upstreamChain.clear();
-	
-	int nvertices = boost::num_vertices(_graph);
-	
-	if(nvertices){
-		UpstreamVisitor visitor;
-		visitor.collectedAttributes = &upstreamChain;
-		
-		std::vector<boost::default_color_type> color_map(nvertices);
-		boost::reverse_graph<Graph> reverseGraph(_graph);
-		boost::depth_first_visit(reverseGraph, boost::vertex(attribute->id(), _graph), visitor, 
-			boost::make_iterator_property_map(color_map.begin(), boost::get(boost::vertex_index, _graph), color_map[0]));
+int NetworkManager::useNextAvailableId(){
+	if(_objectSlots.empty()){
+		// slot 0 is never used so that no object gets 0 as id
+		ObjectSlot nullSlot = {0, 0};
+		_objectSlots.push_back(nullSlot);
 	}
-}
-
-void NetworkManager::collectParentNodeConnectedInputs(Attribute *attribute, Node *parentNode, std::vector<Attribute*> &attributes){
-	std::vector<Attribute*> chain;
-	getUpstreamChain(attribute, chain);
 	
-	for(int i = 0; i < parentNode->_inputAttributes.size(); ++i){
-		Attribute *attr = parentNode->_inputAttributes[i];
-		if(std::find(chain.begin(), chain.end(), attr) != chain.end()){
-			attributes.push_back(attr);
-		}
-	}
-}
-
-void NetworkManager::getCleanChain(Attribute *attribute, std::map<int, std::vector<Attribute*> > &cleanChain, std::map<int, std::vector<Attribute*> > &affectedInputs){
-	Node *startContainerNode = attribute->parent();
-	if(startContainerNode){
-		startContainerNode = startContainerNode->parent();
+	// once the table is full freed slots are reused right away, a slot past the mask would alias another one's ids
+	bool tableFull = _objectSlots.size() > slotMask;
+	if(tableFull && _freeObjectSlots.empty()){
+		// every id was handed out, the object is left unregistered with the invalid id 0
+		return 0;
 	}
-
-	std::vector<Attribute*> attributes;
-	getUpstreamChain(attribute, attributes);
-	
-	cleanChain.clear();
-	affectedInputs.clear();
 	
-	int nvertices = boost::num_vertices(_graph);
-	std::vector<int> attrDependencyOrder(nvertices, 0);
-	
-	// sort the chain in parallel slices
-	std::vector<Node*> processedNodes;
-	int offset = 0;
-	for(int i = 0; i < attributes.size(); ++i){
-		Attribute *attr = attributes[i];
-		int attrId = attr->id();
-		
-		if(in_degree(attrId, _graph) > 0){
-			Graph::in_edge_iterator j, j_end;
-			int maxdist = 0;
-			
-			for(boost::tie(j, j_end) = boost::in_edges(attrId, _graph); j != j_end; ++j){
-				maxdist = std::max(attrDependencyOrder[source(*j, _graph)], maxdist);
-			}
-			
-			attrDependencyOrder[attrId] = maxdist + 1;
-		}
+	int slot;
+	if(_freeObjectSlots.size() > minFreeObjectSlots || tableFull){
+		slot = _freeObjectSlots.front();
+		_freeObjectSlots.pop_front();
+	}
+	else{
+		slot = (int)_objectSlots.size();
 		
-		if(attr->isOutput()){
-			Node *parentNode = attr->parent();
-			if(parentNode){
-				Node *containerNode = parentNode->parent();
-
-				if(containerUtils::elementInContainer(parentNode, processedNodes)){ // make sure the same node doesn't fall in the same slice more than once.
-					offset++;
-				}
-
-				int dependencyOrder = attrDependencyOrder[attrId] + offset;
-				std::vector<Attribute*> &slice = cleanChain[dependencyOrder];
-				slice.push_back(attr);
-				
-				processedNodes.push_back(parentNode);
-				
-				std::vector<Attribute*> &inputs = affectedInputs[attr->id()];
-				collectParentNodeConnectedInputs(attr, parentNode, inputs);
-			}
-		}
+		ObjectSlot newSlot = {0, 0};
+		_objectSlots.push_back(newSlot);
 	}
+	
+	return (_objectSlots[slot].generation << slotBits) | slot;
 }
 
-
-void NetworkManager::addEdge(Attribute *attributeA, Attribute *attributeB){
-	boost::add_edge(attributeA->id(), attributeB->id(), _graph);
-}
-
-void NetworkManager::removeEdge(Attribute *attributeA, Attribute *attributeB){
-	boost::remove_edge(attributeA->id(), attributeB->id(), _graph);
-}
-
-int NetworkManager::useNextAvailableId(){
-	_nextAvailableId += 1;
+int NetworkManager::slotFromId(int id){
+	int slot = id & slotMask;
+	if(id > 0 && slot < _objectSlots.size() && _objectSlots[slot].generation == ((id >> slotBits) & generationMask)){
+		return slot;
+	}
 	
-	return _nextAvailableId;
+	return 0;
 }
 
 void NetworkManager::storeObject(int id, Object *object){
-	_objectsById[id] = object;
+	int slot = slotFromId(id);
+	if(slot){
+		_objectSlots[slot].object = object;
+		_objectCount++;
+	}
 }
 
 void NetworkManager::removeObject(int id){
-	std::map<int, Object *>::iterator it = _objectsById.find(id);
-	if(it != _objectsById.end()){
-		_objectsById.erase(it);
+	int slot = slotFromId(id);
+	if(slot && _objectSlots[slot].object){
+		ObjectSlot &objectSlot = _objectSlots[slot];
+		objectSlot.object = 0;
+		_objectCount--;
+		
+		// a slot that used up its generations is retired instead of wrapping around, 
+		// its last generation would otherwise come back and the ids of deleted objects would resolve to new ones.
+		if(objectSlot.generation < generationMask){
+			objectSlot.generation++;
+			_freeObjectSlots.push_back(slot);
+		}
 	}
 }
 
 int NetworkManager::objectCount(){
-	return (int)_objectsById.size();
+	return _objectCount;
 }
 
 Object *NetworkManager::findObjectById(int id){
-	Object *foundObject = 0;
-	
-	std::map<int, Object *>::iterator it = _objectsById.find(id);
-	if(it != _objectsById.end()){
-		foundObject = _objectsById[id];
+	int slot = slotFromId(id);
+	if(slot){
+		return _objectSlots[slot].object;
 	}
 	
-	return foundObject;
+	return 0;
 }
 
 bool NetworkManager::isCycle(Attribute *attribute, Attribute *input){
-
-	if(attribute && input){
-		bool inputNeedsRecursion = false;
-		bool affectedByNeedsRecursion = false;
-
-		if(attribute->_isInput && attribute->_input){
-			if(attribute->_input == input)
-				return true;
-			else
-				inputNeedsRecursion = true;
+	if(attribute == 0 || input == 0){
+		return false;
+	}
+	
+	if(attribute == input){
+		return true;
+	}
+	
+	// levels of an up to date plan grow along every connection and affect, 
+	// input can only be found upstream of attribute if it sits on a lower level of the same plan.
+	// Plans are not rebuilt while batch editing, so they can't be trusted until the batch is over.
+	int inputLevel = -1;
+	EvaluationPlan *plan = attribute->_evaluationPlan.get();
+	if(plan && _batchEditDepth == 0){
+		if(input->_evaluationPlan.get() != plan){
+			return false;
 		}
-		// check attribute->affectedBy() too before starting an input recursion
-		else if(attribute->_isOutput && attribute->_affectedBy.empty() == false){
-			if(attribute->isAffectedBy(input))
-				return true;
-			else
-				affectedByNeedsRecursion = true;
+		
+		inputLevel = plan->levelAt(input->_planIndex);
+		if(inputLevel >= plan->levelAt(attribute->_planIndex)){
+			return false;
 		}
-
-		if(inputNeedsRecursion)
-			if(isCycle(attribute->_input, input))
+	}
+	
+	// walk upstream of attribute visiting each attribute once
+	unsigned int visitStamp = Attribute::newVisitStamp();
+	attribute->_visitStamp = visitStamp;
+	
+	std::vector<Attribute*> stack(1, attribute);
+	while(stack.empty() == false){
+		Attribute *current = stack.back();
+		stack.pop_back();
+		
+		int upstreamSize = current->_affectedBy.size();
+		for(int i = 0; i <= upstreamSize; ++i){
+			Attribute *upstream = i < upstreamSize ? current->_affectedBy[i] : current->_input;
+			if(upstream == 0 || upstream->_visitStamp == visitStamp){
+				continue;
+			}
+			
+			if(upstream == input){
 				return true;
-
-		if(affectedByNeedsRecursion){
-			for(unsigned int u = 0; u < attribute->_affectedBy.size(); ++u){
-				if(isCycle(attribute->_affectedBy[u], input)){
-					return true;
-				}
+			}
+			
+			upstream->_visitStamp = visitStamp;
+			
+			if(inputLevel == -1 || plan->levelAt(upstream->_planIndex) > inputLevel){
+				stack.push_back(upstream);
 			}
 		}
 	}
-
+	
 	return false;
 }
 
@@ -334,6 +289,9 @@ bool NetworkManager::connect(Attribute *sourceAttribute, Attribute *destinationA
 	
 	errorObject->addReference();
 	
+	AsyncEvaluation::cancelPending(sourceAttribute);
+	AsyncEvaluation::cancelPending(destinationAttribute);
+	
 	if(allowConnection(sourceAttribute, destinationAttribute, errorObject)){
 		success = sourceAttribute->connectTo(destinationAttribute, errorObject);
 	}
@@ -373,3 +331,127 @@ void NetworkManager::addSearchPath(const std::string &path){
 void NetworkManager::removeSearchPath(const std::string &path){
 	containerUtils::eraseElementInContainer(path, _searchPaths);
 }
+
+void NetworkManager::beginBatchEdit(){
+	_batchEditDepth++;
+}
+
+bool NetworkManager::isBatchEditing(){
+	return _batchEditDepth > 0;
+}
+
+void NetworkManager::setEarlyCutoff(bool value){
+	_earlyCutoff = value;
+}
+
+bool NetworkManager::earlyCutoff(){
+	return _earlyCutoff;
+}
+
+unsigned int NetworkManager::graphRevision(){
+	return _graphRevision;
+}
+
+void NetworkManager::graphChanged(){
+	_graphRevision++;
+}
+
+void NetworkManager::deferEvaluationChain(Attribute *attribute){
+	_deferredEvaluationChains.insert(attribute->id());
+}
+
+void NetworkManager::deferBranchSpecializations(Attribute *attribute, bool reset){
+	bool &deferredReset = _deferredBranchSpecializations[attribute->id()];
+	deferredReset = deferredReset || reset;
+}
+
+void NetworkManager::deferConnectionCheck(Attribute *sourceAttribute, Attribute *destinationAttribute){
+	_deferredConnections.push_back(std::make_pair(sourceAttribute->id(), destinationAttribute->id()));
+}
+
+std::vector<Attribute*> NetworkManager::failedBatchConnections(){
+	std::vector<Attribute*> attributes;
+	for(int i = 0; i < _failedBatchConnections.size(); ++i){
+		Attribute *attribute = (Attribute*)findObjectById(_failedBatchConnections[i]);
+		if(attribute && !attribute->isDeleted()){
+			attributes.push_back(attribute);
+		}
+	}
+	
+	return attributes;
+}
+
+void NetworkManager::endBatchEdit(){
+	if(_batchEditDepth == 0){
+		return;
+	}
+	
+	_batchEditDepth--;
+	if(_batchEditDepth > 0){
+		return;
+	}
+	
+	// attributes deleted during the batch are simply skipped
+	std::vector<Attribute*> attributes;
+	for(std::set<int>::iterator it = _deferredEvaluationChains.begin(); it != _deferredEvaluationChains.end(); ++it){
+		Attribute *attribute = (Attribute*)findObjectById(*it);
+		if(attribute && !attribute->isDeleted()){
+			attributes.push_back(attribute);
+		}
+	}
+	_deferredEvaluationChains.clear();
+	
+	// one plan for each group of connected attributes
+	std::set<EvaluationPlan*> builtPlans;
+	for(int i = 0; i < attributes.size(); ++i){
+		Attribute *attribute = attributes[i];
+		if(!attribute->_evaluationPlan || builtPlans.find(attribute->_evaluationPlan.get()) == builtPlans.end()){
+			EvaluationPlan::build(attribute);
+			builtPlans.insert(attribute->_evaluationPlan.get());
+		}
+	}
+	
+	// solve each specialization branch once, branches that requested a reset go first.
+	std::map<int, bool> deferredBranchSpecializations = _deferredBranchSpecializations;
+	_deferredBranchSpecializations.clear();
+	
+	std::set<int> solvedAttributes;
+	std::set<int> failedAttributes;
+	for(int pass = 0; pass < 2; ++pass){
+		bool reset = pass == 0;
+		
+		for(std::map<int, bool>::iterator it = deferredBranchSpecializations.begin(); it != deferredBranchSpecializations.end(); ++it){
+			if(it->second == reset && solvedAttributes.find(it->first) == solvedAttributes.end()){
+				Attribute *attribute = (Attribute*)findObjectById(it->first);
+				if(attribute && !attribute->isDeleted()){
+					std::set<int> branchAttributes;
+					if(!attribute->updateBranchSpecializations(reset, &branchAttributes)){
+						failedAttributes.insert(branchAttributes.begin(), branchAttributes.end());
+					}
+					
+					solvedAttributes.insert(branchAttributes.begin(), branchAttributes.end());
+				}
+			}
+		}
+	}
+	
+	// now that the specializations are solved, check the connections still in place as connect() would have
+	std::vector<std::pair<int, int> > deferredConnections;
+	deferredConnections.swap(_deferredConnections);
+	
+	_failedBatchConnections.clear();
+	for(int i = 0; i < deferredConnections.size(); ++i){
+		Attribute *sourceAttribute = (Attribute*)findObjectById(deferredConnections[i].first);
+		Attribute *destinationAttribute = (Attribute*)findObjectById(deferredConnections[i].second);
+		if(sourceAttribute && destinationAttribute && !destinationAttribute->isDeleted() && destinationAttribute->input() == sourceAttribute){
+			if(failedAttributes.find(destinationAttribute->id()) != failedAttributes.end() || !sourceAttribute->allowConnectionTo(destinationAttribute)){
+				_failedBatchConnections.push_back(destinationAttribute->id());
+			}
+		}
+	}
+	
+	// the plans were stale while connecting, dirty everything that was touched by the batch, 
+	// forced like a single connection would do.
+	bool force = true;
+	Attribute::dirtyDownstream(attributes, force);
+}
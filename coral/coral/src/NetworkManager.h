@@ -33,6 +33,8 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
+#include <deque>
 #include "coralDefinitions.h"
 
 namespace coral{
@@ -46,15 +48,47 @@ class ErrorObject;
 class CORAL_EXPORT NetworkManager{
 public:
 	static int objectCount();
+	
+	//! Returns the object with the given id in constant time, or 0 if the object was deleted.
+	//! Ids pack a slot index and the generation of that slot, so the id of a deleted object never resolves to a newer object reusing its slot: 
+	//! slots are retired once their generations are used up rather than wrapping around. When every id was handed out new objects get the invalid id 0, 
+	//! see Object::id(), and can't be found.
 	static Object *findObjectById(int id);
 	static bool allowConnection(Attribute *sourceAttribute, Attribute *destinationAttribute, ErrorObject *errorObject);
 	static bool connect(Attribute *sourceAttribute, Attribute *destinationAttribute, ErrorObject *errorObject = 0);
+	
+	//! Returns true if connecting sourceAttribute to destinationAttribute would close a loop, that is destinationAttribute is found upstream of sourceAttribute.
+	//! Each upstream attribute is visited at most once and the levels of the evaluation plan rule out most checks without walking the network at all.
 	static bool isCycle(Attribute *sourceAttribute, Attribute *destinationAttribute);
-	static void getDownstreamChain(Attribute *attribute, std::vector<Attribute*> &downstreamChain);
-	static void getUpstreamChain(Attribute *attribute, std::vector<Attribute*> &upstreamChain);
+	
+	//! Collects the attributes of node and of the nodes nested under it that are classified as static, see Attribute::isAnimated().
+	static void getStaticAttributes(Node *node, std::vector<Attribute*> &staticAttributes);
 	static std::string resolveFilename(const std::string &filename);
 	static void addSearchPath(const std::string &path);
 	static void removeSearchPath(const std::string &path);
+	
+	//! Starts a batch of edits, until the matching endBatchEdit() is called connections won't rebuild the evaluation chains 
+	//! or the specializations of the attributes they touch, batches can be nested.
+	static void beginBatchEdit();
+	
+	//! Ends a batch of edits, the outermost call rebuilds the evaluation chains and specializations postponed during the batch, 
+	//! visiting the affected subgraph only once.
+	//! Connections made during a batch can't fail on their specializations until then, see failedBatchConnections().
+	static void endBatchEdit();
+	static bool isBatchEditing();
+	
+	//! The destination attributes of the connections made during the last batch whose specializations didn't match once solved, 
+	//! their source is still their input(): like a connect() failing outside of a batch, the connections are kept.
+	static std::vector<Attribute*> failedBatchConnections();
+	
+	//! When early cutoff is enabled outputs are hashed after each update, and an attribute is not recomputed when none of the attributes affecting it 
+	//! changed value since its last update. Only valid for nodes whose update depends on nothing but their input attributes, disabled by default.
+	static void setEarlyCutoff(bool value);
+	static bool earlyCutoff();
+	
+	//! A counter increased by every edit to the structure of the graph: connections, affects, lazy inputs and deletions.
+	//! Views of the graph cached outside of the attributes, such as a CompiledNetwork, are out of date once it changes.
+	static unsigned int graphRevision();
 
 private:
 	friend class Object;
@@ -64,14 +98,29 @@ private:
 	static int useNextAvailableId();
 	static void storeObject(int id, Object *object);
 	static void removeObject(int id);
-	static void addEdge(Attribute *attributeA, Attribute *attributeB);
-	static void removeEdge(Attribute *attributeA, Attribute *attributeB);
-	static void getCleanChain(Attribute *attribute, std::map<int, std::vector<Attribute*> > &cleanChain, std::map<int, std::vector<Attribute*> > &affectedInputs);
-	static void collectParentNodeConnectedInputs(Attribute *attribute, Node *parentNode, std::vector<Attribute*> &attributes);
+	static void deferEvaluationChain(Attribute *attribute);
+	static void deferBranchSpecializations(Attribute *attribute, bool reset);
+	static void deferConnectionCheck(Attribute *sourceAttribute, Attribute *destinationAttribute);
+	static void graphChanged();
 
-	static int _nextAvailableId;
-	static std::map<int, Object *> _objectsById;
+	struct ObjectSlot{
+		Object *object;
+		int generation;
+	};
+	
+	static int slotFromId(int id);
+	
+	static std::vector<ObjectSlot> _objectSlots;
+	static std::deque<int> _freeObjectSlots;
+	static int _objectCount;
 	static std::vector<std::string> _searchPaths;
+	static int _batchEditDepth;
+	static bool _earlyCutoff;
+	static unsigned int _graphRevision;
+	static std::set<int> _deferredEvaluationChains;
+	static std::map<int, bool> _deferredBranchSpecializations;
+	static std::vector<std::pair<int, int> > _deferredConnections;
+	static std::vector<int> _failedBatchConnections;
 };
 
 }
@@ -39,6 +39,8 @@
 #include "containerUtils.h"
 #include "Command.h"
 #include "stringUtils.h"
+#include "Profiler.h"
+#include "TimeSampler.h"
 
 using namespace coral;
 
@@ -74,12 +76,18 @@ Node::Node(const std::string &name, Node *parent):
 	_computeTimeSeconds(0),
 	_computeTimeMilliseconds(0),
 	_computeTimeTicks(0),
+	_updateCount(0),
+	_totalUpdateTime(0.0),
+	_maxUpdateTime(0.0),
+	_updatedSlices(0),
 	_allowDynamicAttributes(false),
 	_constructorDone(false),
 	_specializationPreset("none"),
 	_slices(1),
 	_isSlicer(false),
-	_sliceable(false){
+	_sliceable(false),
+	_updateOutputsTogether(false),
+	_keepsState(false){
 	
 	_slicer = findParentSlicer();
 }
@@ -124,7 +132,8 @@ bool Node::updateEnabled(){
 }
 
 bool Node::containsNode(Node *node){
-	return containerUtils::elementInContainer(node, _nodes);
+	// every child node is also a child object
+	return containsObject(node);
 }
 
 void Node::removeNode(Node *node){
@@ -211,6 +220,8 @@ void Node::resizedSlices(unsigned int slices){
 }
 
 void Node::doUpdate(Attribute *attribute){
+	ProfilerScope profilerScope(Profiler::spanTypeNodeUpdate, attribute);
+	
 	boost::posix_time::ptime startTime = boost::posix_time::microsec_clock::universal_time();
 	
 	update(attribute);
@@ -221,29 +232,61 @@ void Node::doUpdate(Attribute *attribute){
 	_computeTimeSeconds = enlapsed.length().total_seconds();
 	_computeTimeMilliseconds = enlapsed.length().total_milliseconds() % 1000;
 	_computeTimeTicks = enlapsed.length().ticks();
+	
+	countUpdate(enlapsed.length().total_microseconds() / 1000000.0);
+}
+
+void Node::doUpdate(const std::vector<Attribute*> &outputs){
+	ProfilerScope profilerScope(Profiler::spanTypeNodeUpdate, outputs[0]);
+	
+	boost::posix_time::ptime startTime = boost::posix_time::microsec_clock::universal_time();
+	
+	updateOutputs(outputs);
+	
+	boost::posix_time::ptime endTime = boost::posix_time::microsec_clock::universal_time();
+	boost::posix_time::time_period enlapsed(startTime, endTime);
+	
+	_computeTimeSeconds = enlapsed.length().total_seconds();
+	_computeTimeMilliseconds = enlapsed.length().total_milliseconds() % 1000;
+	_computeTimeTicks = enlapsed.length().ticks();
+	
+	countUpdate(enlapsed.length().total_microseconds() / 1000000.0);
+}
+
+void Node::countUpdate(double seconds){
+	_updateCount++;
+	_updatedSlices += _slices;
+	_totalUpdateTime += seconds;
+	if(seconds > _maxUpdateTime){
+		_maxUpdateTime = seconds;
+	}
 }
 
 void Node::updateSlice(Attribute *attribute, unsigned int slice){
 }
 
+void Node::resizeOutputSlices(){
+	// here we resize the slices for the output attributes so that the node can put values in each slice.
+	unsigned int slices = _slicer->computeSlices();
+	if(_inputAttributes.size()){
+		for(int i = 0; i < _outputAttributes.size(); ++i){
+			_outputAttributes[i]->outValue()->resizeSlices(slices);
+		}
+		
+		_slices = slices;
+		resizedSlices(slices);
+	}
+}
+
 void Node::update(Attribute *attribute){
 	if(_slicer){ // this node is nested in a slicer node such as the ForLoop node and this node is supposed to be sliced
-		// here we resize the slices for the output attributes so that the node can put values in each slice.
-
-		unsigned int slices = _slicer->computeSlices();
-		if(_inputAttributes.size()){
-			for(int i = 0; i < _outputAttributes.size(); ++i){
-				_outputAttributes[i]->outValue()->resizeSlices(slices);
-			}
-			
-			_slices = slices;
-			resizedSlices(slices);
-		}
+		resizeOutputSlices();
 
 		#ifdef CORAL_PARALLEL_TBB
-			tbb::parallel_for(tbb::blocked_range<size_t>(0, _slices), node_parallelUpdate(this, attribute));
+			tbb::parallel_for(tbb::blocked_range<size_t>(0, _slices), node_parallelUpdate(this, attribute, attribute->evaluationContext()));
 		#else
 			for(int i = 0; i < _slices; ++i){
+				ProfilerScope profilerScope(Profiler::spanTypeSlice, attribute, i);
 				updateSlice(attribute, i);
 			}
 		#endif
@@ -253,6 +296,30 @@ void Node::update(Attribute *attribute){
 	}
 }
 
+void Node::updateOutputs(const std::vector<Attribute*> &outputs){
+	if(_slicer){
+		resizeOutputSlices();
+
+		#ifdef CORAL_PARALLEL_TBB
+			tbb::parallel_for(tbb::blocked_range<size_t>(0, _slices), node_parallelUpdateOutputs(this, &outputs, outputs[0]->evaluationContext()));
+		#else
+			for(int i = 0; i < _slices; ++i){
+				ProfilerScope profilerScope(Profiler::spanTypeSlice, outputs[0], i);
+				updateOutputsSlice(outputs, i);
+			}
+		#endif
+	}
+	else{
+		updateOutputsSlice(outputs, 0);
+	}
+}
+
+void Node::updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice){
+	for(int i = 0; i < outputs.size(); ++i){
+		updateSlice(outputs[i], slice);
+	}
+}
+
 Node *Node::parent(){
 	return (Node*)parentObject();
 }
@@ -266,7 +333,7 @@ void Node::setParent(Node *parent){
 }
 
 void Node::addNode(Node *node){
-	if(containerUtils::elementInContainer(node, _nodes) == false){
+	if(containsNode(node) == false){
 		_nodes.push_back(node);
 		
 		addObject(node);
@@ -321,40 +388,12 @@ const std::vector<Attribute*> &Node::outputAttributes(){
 }
 
 Node *Node::findNode(const std::string &name){
-	Node *foundNode = 0;
-	for(std::vector<Node*>::iterator it = _nodes.begin(); it != _nodes.end(); ++it){
-		Node *node = *it;
-		if(node->name() == name){
-			foundNode = node;
-			break;
-		}
-	}
-	
-	return foundNode;
+	// nodes and attributes share the name index of their parent
+	return dynamic_cast<Node*>(findObject(name));
 }
 
 Attribute *Node::findAttribute(const std::string &name){
-	Attribute *foundAttribute = 0;
-	
-	for(std::vector<Attribute*>::iterator it = _inputAttributes.begin(); it != _inputAttributes.end(); ++it){
-		Attribute *attribute = *it;
-		if(attribute->name() == name){
-			foundAttribute = attribute;
-			break;
-		}
-	}
-	
-	if(foundAttribute == 0){
-		for(std::vector<Attribute*>::iterator it = _outputAttributes.begin(); it != _outputAttributes.end(); ++it){
-			Attribute *attribute = *it;
-			if(attribute->name() == name){
-				foundAttribute = attribute;
-				break;
-			}
-		}
-	}
-	
-	return foundAttribute;
+	return dynamic_cast<Attribute*>(findObject(name));
 }
 
 void Node::deleteIt(){
@@ -382,6 +421,8 @@ void Node::deleteIt(){
 		removeAttribute(*itAttribute);
 	}
 	
+	NetworkManager::graphChanged();
+	
 	setIsDeleted(true);
 }
 
@@ -422,6 +463,11 @@ void Node::setAttributeAffect(Attribute *source, Attribute *destination){
 
 void Node::setAttributeIsClean(Attribute *attribute, bool value){
 	if(containerUtils::elementInContainer((NestedObject*)attribute, _objects)){
+		if(TimeSampler::setSampleAttributeIsClean(attribute, value)){
+			// updated for a time sample on its own copy of the values, the network keeps its state
+			return;
+		}
+		
 		attribute->setIsClean(value);
 	}
 }
@@ -649,6 +695,9 @@ std::string Node::debugInfo(){
 	std::string info = shortDebugInfo() + "\n";
 	
 	info += "last update took: secs:" + stringUtils::intToString(_computeTimeSeconds) + ", millisecs: " + stringUtils::intToString(_computeTimeMilliseconds) + "\n";
+	info += "updates: " + stringUtils::intToString(_updateCount) + ", slices: " + stringUtils::intToString(_updatedSlices);
+	info += ", total time: " + stringUtils::floatToString(_totalUpdateTime) + " secs, max time: " + stringUtils::floatToString(_maxUpdateTime) + " secs";
+	info += ", output bytes: " + stringUtils::intToString(outputBytes()) + "\n";
 	info += "attributes:\n";
 	
 	for(int i = 0; i < _inputAttributes.size(); ++i){
@@ -674,6 +723,43 @@ int Node::computeTimeSeconds(){
 	return _computeTimeSeconds;
 }
 
+int Node::updateCount(){
+	return _updateCount;
+}
+
+double Node::totalUpdateTime(){
+	return _totalUpdateTime;
+}
+
+double Node::maxUpdateTime(){
+	return _maxUpdateTime;
+}
+
+int Node::updatedSlices(){
+	return _updatedSlices;
+}
+
+void Node::resetCounters(){
+	_updateCount = 0;
+	_totalUpdateTime = 0.0;
+	_maxUpdateTime = 0.0;
+	_updatedSlices = 0;
+	
+	std::vector<Attribute*> attrs = attributes();
+	for(int i = 0; i < attrs.size(); ++i){
+		attrs[i]->resetCounters();
+	}
+}
+
+std::size_t Node::outputBytes(){
+	std::size_t bytes = 0;
+	for(int i = 0; i < _outputAttributes.size(); ++i){
+		bytes += _outputAttributes[i]->valueBytes();
+	}
+	
+	return bytes;
+}
+
 const std::vector<Attribute*> &Node::dynamicAttributes(){
 	return _dynamicAttributes;
 }
@@ -758,6 +844,18 @@ void Node::catchAttributeDirtied(Attribute *attribute, bool value){
 void Node::attributeDirtied(Attribute *attribute){
 }
 
+void Node::setAttributeIsLazy(Attribute *attribute, bool value){
+	if(attribute->isInput() && containerUtils::elementInContainer(attribute, attributes())){
+		attribute->setIsLazy(value);
+	}
+}
+
+void Node::setAttributeIsAnimated(Attribute *attribute, bool value){
+	if(containerUtils::elementInContainer(attribute, attributes())){
+		attribute->setIsAnimatedSource(value);
+	}
+}
+
 void Node::setIsSlicer(bool value){
 	_isSlicer = value;
 }
@@ -777,3 +875,21 @@ void Node::setSliceable(bool value){
 bool Node::sliceable(){
 	return _sliceable;
 }
+
+void Node::setUpdateOutputsTogether(bool value){
+	_updateOutputsTogether = value;
+	
+	NetworkManager::graphChanged();
+}
+
+bool Node::updateOutputsTogether(){
+	return _updateOutputsTogether;
+}
+
+void Node::setKeepsState(bool value){
+	_keepsState = value;
+}
+
+bool Node::keepsState(){
+	return _keepsState;
+}
@@ -41,6 +41,7 @@ class Attribute;
 class NodeAccessor;
 class SpecializationLink;
 class node_parallelUpdate;
+class node_parallelUpdateOutputs;
 
 
 //! The base class to all nodes.
@@ -73,6 +74,20 @@ public:
 	int computeTimeTicks();
 	int computeTimeMilliseconds();
 	int computeTimeSeconds();
+	
+	//! Counters kept since the creation of this node or the last call to resetCounters():
+	//! the number of updates, the seconds they took in total and the longest one,
+	//! and the number of slices computed, nodes that are not nested in a slicer compute one slice per update.
+	int updateCount();
+	double totalUpdateTime();
+	double maxUpdateTime();
+	int updatedSlices();
+	
+	//! Resets the counters of this node and of its attributes.
+	void resetCounters();
+	
+	//! The memory held by the values of the outputs of this node, see Attribute::valueBytes().
+	std::size_t outputBytes();
 	const std::vector<Attribute*> &dynamicAttributes();
 	bool allowDynamicAttributes();
 	void enableSpecializationPreset(const std::string &preset);
@@ -86,6 +101,12 @@ public:
 
 	//! Returns the parent node in charge of imposing the number of slices such as a ForLoop node, if there's no slicer this value is NULL.
 	Node *slicer();
+	
+	//! Indicates if the dirty outputs of this node are computed together by a single updateOutputs() call, this value is false by default.
+	bool updateOutputsTogether();
+	
+	//! Indicates if this node keeps a state from one update to the next, this value is false by default and true for nodes written in python.
+	bool keepsState();
 
 	//! Returns all the available presets for this node.
 	std::vector<std::string> specializationPresets();
@@ -116,6 +137,14 @@ public:
 	virtual void addDynamicAttribute(Attribute *attribute);
 	virtual void removeDynamicAttribute(Attribute *attribute);
 	virtual void updateSlice(Attribute *attribute, unsigned int slice);
+	
+	//! Invoked instead of update(attribute) on nodes declared as setUpdateOutputsTogether(true), 
+	//! outputs contains all the dirty outputs of this node that can be computed at this point of the evaluation.
+	//! The default implementation takes care of slicing and calls updateOutputsSlice() for each slice.
+	virtual void updateOutputs(const std::vector<Attribute*> &outputs);
+	
+	//! The sliced counterpart of updateOutputs(outputs), the default implementation calls updateSlice(attribute, slice) for each output.
+	virtual void updateOutputsSlice(const std::vector<Attribute*> &outputs, unsigned int slice);
 
 	//! This method is invoked before updateSlice if there is a change in the number of slices imposed by the slicer.
 	//! Overriding this method is often handy when a node has some internal data that needs to be sliced accordingly. 
@@ -153,16 +182,39 @@ protected:
 	//! Loop nodes such as the ForLoop node are marked as setIsSlicer(true) and they compute a slicing count for their children nodes by overriding the 
 	//! virtual method unsigned int computeSlices().
 	void setIsSlicer(bool value);
+	
+	//! Nodes computing several outputs out of the same work, such as a geometry query, can be declared as setUpdateOutputsTogether(true) 
+	//! and override updateOutputs() or updateOutputsSlice(), the dirty outputs will then be computed by one call instead of one update per output.
+	void setUpdateOutputsTogether(bool value);
+	
+	//! Nodes keeping a state from one update to the next, such as SetSimulationStep, are declared as setKeepsState(true): 
+	//! a TimeSampler then evaluates the samples reaching them one after the other instead of concurrently.
+	void setKeepsState(bool value);
+	
+	//! Inputs declared as lazy are not evaluated before this node gets updated, only if and when the update reads them through value().
+	//! Nodes selecting one among several inputs, such as ConditionalValue, use this to skip computing the branches they don't pick.
+	//! A lazy input must still be declared as affecting the outputs that read it.
+	void setAttributeIsLazy(Attribute *attribute, bool value = true);
+	
+	//! Declares an attribute whose value changes from frame to frame on its own, like the time output of a Time node.
+	//! Every attribute downstream of it is classified as animated, the rest of the network as static, see Attribute::isAnimated().
+	void setAttributeIsAnimated(Attribute *attribute, bool value = true);
 
 private:
 	friend class NodeAccessor;
 	friend class NetworkManager;
 	friend class Attribute;
 	friend class node_parallelUpdate;
+	friend class node_parallelUpdateOutputs;
+	friend class CompiledNetwork;
+	friend class TimeSampler;
 	
 	std::string saveContentRecursive(bool thisIsRoot);
 	std::string saveNodeConnectionsScript(Node *node);
 	void doUpdate(Attribute *attribute);
+	void doUpdate(const std::vector<Attribute*> &outputs);
+	void resizeOutputSlices();
+	void countUpdate(double seconds);
 	std::string attrsVectorToStr(const std::vector<Attribute*> &vec);
 	void _attributeConnectionChanged(Attribute *attribute);
 	Node *findParentSlicer();
@@ -178,6 +230,10 @@ private:
 	int _computeTimeSeconds;
 	int _computeTimeMilliseconds;
 	int _computeTimeTicks;
+	int _updateCount;
+	double _totalUpdateTime;
+	double _maxUpdateTime;
+	int _updatedSlices;
 	bool _allowDynamicAttributes;
 	bool _constructorDone;
 	std::string _specializationPreset;
@@ -185,6 +241,8 @@ private:
 	bool _isSlicer;
 	Node *_slicer;
 	bool _sliceable;
+	bool _updateOutputsTogether;
+	bool _keepsState;
 
 	Node();
 	Node(const Node &other);
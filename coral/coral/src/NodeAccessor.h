@@ -80,6 +80,14 @@ public:
 	static void _setSliceable(Node &self, bool value){
 		self.setSliceable(value);
 	}
+	
+	static void _setKeepsState(Node &self, bool value){
+		self.setKeepsState(value);
+	}
+	
+	static void _setAttributeIsAnimated(Node &self, Attribute *attribute, bool value){
+		self.setAttributeIsAnimated(attribute, value);
+	}
 };
 
 }
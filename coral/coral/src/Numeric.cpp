@@ -33,34 +33,86 @@
 
 using namespace coral;
 
+namespace {
+	template<class T>
+	void hashSlices(const SlicedValues<T> &valuesSliced, std::size_t &hash){
+		for(int i = 0; i < valuesSliced.slices(); ++i){
+			hash = Value::hashBytes(&i, sizeof(int), hash);
+			
+			// implicit slices are hashed in their compact form, expanding them only to hash them would defeat their purpose.
+			if(valuesSliced.isImplicit(i)){
+				const ImplicitSlice<T> &implicit = valuesSliced.implicitSlice(i);
+				hash = Value::hashBytes(&implicit.first, sizeof(T), hash);
+				hash = Value::hashBytes(&implicit.size, sizeof(unsigned int), hash);
+				if(implicit.isRange){
+					hash = Value::hashBytes(&implicit.step, sizeof(T), hash);
+				}
+				
+				continue;
+			}
+			
+			SliceView<T> values = valuesSliced.slice(i);
+			if(values.size()){
+				hash = Value::hashBytes(&values[0], values.size() * sizeof(T), hash);
+			}
+		}
+	}
+	
+	template<class T>
+	bool isImplicitSlice(const SlicedValues<T> &valuesSliced, unsigned int slice, bool isRange){
+		if(slice >= valuesSliced.slices()){
+			slice = valuesSliced.slices() - 1;
+		}
+		
+		return valuesSliced.isImplicit(slice) && valuesSliced.implicitSlice(slice).isRange == isRange;
+	}
+	
+	template<class T>
+	T rangeStepSlice(const SlicedValues<T> &valuesSliced, unsigned int slice){
+		if(slice >= valuesSliced.slices()){
+			slice = valuesSliced.slices() - 1;
+		}
+		
+		if(valuesSliced.isImplicit(slice) && valuesSliced.implicitSlice(slice).isRange){
+			return valuesSliced.implicitSlice(slice).step;
+		}
+		
+		return T(0);
+	}
+	
+	#ifdef CORAL_PARALLEL_TBB
+		tbb::mutex _expansionMutex;
+	#endif
+}
+
+#ifdef CORAL_PARALLEL_TBB
+tbb::mutex &coral::slicedValues_expansionMutex(){
+	return _expansionMutex;
+}
+#endif
+
 Numeric::Numeric():
 	_type(numericTypeAny),
 	_isArray(false),
 	_slices(1){
 	
-	_intValuesSliced.resize(1);
-	_intValuesSliced[0].resize(1);
-	_intValuesSliced[0][0] = 0;
+	_intValuesSliced.resizeSlices(1, 1);
+	_intValuesSliced.setValueAt(0, 0, 0);
 
-	_floatValuesSliced.resize(1);
-	_floatValuesSliced[0].resize(1);
-	_floatValuesSliced[0][0] = 0.0;
+	_floatValuesSliced.resizeSlices(1, 1);
+	_floatValuesSliced.setValueAt(0, 0, 0.0);
 
-	_vec3ValuesSliced.resize(1);
-	_vec3ValuesSliced[0].resize(1);
-	_vec3ValuesSliced[0][0] = Imath::V3f(0.0, 0.0, 0.0);
+	_vec3ValuesSliced.resizeSlices(1, 1);
+	_vec3ValuesSliced.setValueAt(0, 0, Imath::V3f(0.0, 0.0, 0.0));
 
-	_quatValuesSliced.resize(1);
-	_quatValuesSliced[0].resize(1);
-	_quatValuesSliced[0][0] = Imath::Quatf(0.0, 0.0, 0.0, 1.0);
+	_quatValuesSliced.resizeSlices(1, 1);
+	_quatValuesSliced.setValueAt(0, 0, Imath::Quatf(0.0, 0.0, 0.0, 1.0));
 
-	_matrix44ValuesSliced.resize(1);
-	_matrix44ValuesSliced[0].resize(1);
-	_matrix44ValuesSliced[0][0] = Imath::identity44f;
+	_matrix44ValuesSliced.resizeSlices(1, 1);
+	_matrix44ValuesSliced.setValueAt(0, 0, Imath::identity44f);
 
-	_col4ValuesSliced.resize(1);
-	_col4ValuesSliced[0].resize(1);
-	_col4ValuesSliced[0][0] = Imath::Color4f(1.0, 1.0, 1.0, 1.0);
+	_col4ValuesSliced.resizeSlices(1, 1);
+	_col4ValuesSliced.setValueAt(0, 0, Imath::Color4f(1.0, 1.0, 1.0, 1.0));
 }
 
 void Numeric::copy(const Value *other){
@@ -76,9 +128,20 @@ void Numeric::copy(const Value *other){
 		_quatValuesSliced = otherNum->_quatValuesSliced;
 		_matrix44ValuesSliced = otherNum->_matrix44ValuesSliced;
 		_col4ValuesSliced = otherNum->_col4ValuesSliced;
+		
+		// the storage belongs to this value, not to the one copied
+		setMappedStorage(_mappedStorage);
 	}
 }
 
+Value *Numeric::duplicate(){
+	Numeric *value = new Numeric();
+	value->copy(this);
+	value->_slices = _slices;
+	
+	return value;
+}
+
 bool Numeric::isArray(){
 	return _isArray;
 }
@@ -96,22 +159,22 @@ unsigned int Numeric::sizeSlice(unsigned int slice){
 		return 0;
 	}
 	else if(_type == numericTypeIntArray || _type == numericTypeInt){
-		return _intValuesSliced[slice].size();
+		return _intValuesSliced.sizeSlice(slice);
 	}
 	else if(_type == numericTypeFloatArray || _type == numericTypeFloat){
-		return _floatValuesSliced[slice].size();
+		return _floatValuesSliced.sizeSlice(slice);
 	}
 	else if(_type == numericTypeVec3Array || _type == numericTypeVec3){
-		return _vec3ValuesSliced[slice].size();
+		return _vec3ValuesSliced.sizeSlice(slice);
 	}
 	else if(_type == numericTypeQuatArray || _type == numericTypeQuat){
-		return _quatValuesSliced[slice].size();
+		return _quatValuesSliced.sizeSlice(slice);
 	}
 	else if(_type == numericTypeMatrix44Array || _type == numericTypeMatrix44){
-		return _matrix44ValuesSliced[slice].size();
+		return _matrix44ValuesSliced.sizeSlice(slice);
 	}
 	else if(_type == numericTypeCol4Array || _type == numericTypeCol4){
-		return _col4ValuesSliced[slice].size();
+		return _col4ValuesSliced.sizeSlice(slice);
 	}
 
 	return 0;
@@ -126,63 +189,63 @@ void Numeric::setType(Numeric::Type type){
 	_isArray = false;
 	
 	if(type == numericTypeInt){
-		_intValuesSliced.resize(_slices);
+		_intValuesSliced.resizeSlices(_slices, 1);
 		for(int i = 0; i < _slices; ++i){
-			_intValuesSliced[i].resize(1);
+			_intValuesSliced.resizeSlice(i, 1);
 		}
 	}
 	else if(type == numericTypeIntArray){
-		_intValuesSliced.resize(_slices);
+		_intValuesSliced.resizeSlices(_slices, 0);
 		_isArray = true;
 	}
 	else if(type == numericTypeFloat){
-		_floatValuesSliced.resize(_slices);
+		_floatValuesSliced.resizeSlices(_slices, 1);
 		for(int i = 0; i < _slices; ++i){
-			_floatValuesSliced[i].resize(1);
+			_floatValuesSliced.resizeSlice(i, 1);
 		}
 	}
 	else if(type == numericTypeFloatArray){
-		_floatValuesSliced.resize(_slices);
+		_floatValuesSliced.resizeSlices(_slices, 0);
 		_isArray = true;
 	}
 	else if(type == numericTypeVec3){
-		_vec3ValuesSliced.resize(_slices);
+		_vec3ValuesSliced.resizeSlices(_slices, 1);
 		for(int i = 0; i < _slices; ++i){
-			_vec3ValuesSliced[i].resize(1);
+			_vec3ValuesSliced.resizeSlice(i, 1);
 		}
 	}
 	else if(type == numericTypeVec3Array){
-		_vec3ValuesSliced.resize(_slices);
+		_vec3ValuesSliced.resizeSlices(_slices, 0);
 		_isArray = true;
 	}
 	else if(type == numericTypeQuat){
-		_quatValuesSliced.resize(_slices);
+		_quatValuesSliced.resizeSlices(_slices, 1);
 		for(int i = 0; i < _slices; ++i){
-			_quatValuesSliced[i].resize(1);
+			_quatValuesSliced.resizeSlice(i, 1);
 		}
 	}
 	else if(type == numericTypeQuatArray){
-		_quatValuesSliced.resize(_slices);
+		_quatValuesSliced.resizeSlices(_slices, 0);
 		_isArray = true;
 	}
 	else if(type == numericTypeMatrix44){
-		_matrix44ValuesSliced.resize(_slices);
+		_matrix44ValuesSliced.resizeSlices(_slices, 1);
 		for(int i = 0; i < _slices; ++i){
-			_matrix44ValuesSliced[i].resize(1);
+			_matrix44ValuesSliced.resizeSlice(i, 1);
 		}
 	}
 	else if(type == numericTypeMatrix44Array){
-		_matrix44ValuesSliced.resize(_slices);
+		_matrix44ValuesSliced.resizeSlices(_slices, 0);
 		_isArray = true;
 	}
 	else if(type == numericTypeCol4){
-		_col4ValuesSliced.resize(_slices);
+		_col4ValuesSliced.resizeSlices(_slices, 1);
 		for(int i = 0; i < _slices; ++i){
-			_col4ValuesSliced[i].resize(1);
+			_col4ValuesSliced.resizeSlice(i, 1);
 		}
 	}
 	else if(type == numericTypeCol4Array){
-		_col4ValuesSliced.resize(_slices);
+		_col4ValuesSliced.resizeSlices(_slices, 0);
 		_isArray = true;
 	}
 }
@@ -194,33 +257,33 @@ void Numeric::resize(unsigned int newSize){
 void Numeric::resizeSlice(unsigned int slice, unsigned int newSize){
 	if(_type != numericTypeAny){
 		if(_type == numericTypeInt || _type == numericTypeIntArray){
-			for(int i = 0; i < _intValuesSliced.size(); ++i){
-				_intValuesSliced[i].resize(newSize);
+			for(int i = 0; i < _intValuesSliced.slices(); ++i){
+				_intValuesSliced.resizeSlice(i, newSize);
 			}
 		}
 		else if(_type == numericTypeFloat || _type == numericTypeFloatArray){
-			for(int i = 0; i < _floatValuesSliced.size(); ++i){
-				_floatValuesSliced[i].resize(newSize);
+			for(int i = 0; i < _floatValuesSliced.slices(); ++i){
+				_floatValuesSliced.resizeSlice(i, newSize);
 			}
 		}
 		else if(_type == numericTypeVec3 || _type == numericTypeVec3Array){
-			for(int i = 0; i < _vec3ValuesSliced.size(); ++i){
-				_vec3ValuesSliced[i].resize(newSize);
+			for(int i = 0; i < _vec3ValuesSliced.slices(); ++i){
+				_vec3ValuesSliced.resizeSlice(i, newSize);
 			}
 		}
 		else if(_type == numericTypeQuat || _type == numericTypeQuatArray){
-			for(int i = 0; i < _quatValuesSliced.size(); ++i){
-				_quatValuesSliced[i].resize(newSize);
+			for(int i = 0; i < _quatValuesSliced.slices(); ++i){
+				_quatValuesSliced.resizeSlice(i, newSize);
 			}
 		}
 		else if(_type == numericTypeMatrix44 || _type == numericTypeMatrix44Array){
-			for(int i = 0; i < _matrix44ValuesSliced.size(); ++i){
-				_matrix44ValuesSliced[i].resize(newSize);
+			for(int i = 0; i < _matrix44ValuesSliced.slices(); ++i){
+				_matrix44ValuesSliced.resizeSlice(i, newSize);
 			}
 		}
 		else if(_type == numericTypeCol4 || _type == numericTypeCol4Array){
-			for(int i = 0; i < _col4ValuesSliced.size(); ++i){
-				_col4ValuesSliced[i].resize(newSize);
+			for(int i = 0; i < _col4ValuesSliced.slices(); ++i){
+				_col4ValuesSliced.resizeSlice(i, newSize);
 			}
 		}
 	}
@@ -267,28 +330,28 @@ void Numeric::setMatrix44ValueAt(unsigned int id, const Imath::M44f &value){
 	setMatrix44ValueAtSlice(0, id, value);
 }
 
-const std::vector<int> &Numeric::intValues(){
-	return _intValuesSliced[0];
+SliceView<int> Numeric::intValues(){
+	return _intValuesSliced.slice(0);
 }
 
-const std::vector<float> &Numeric::floatValues(){
-	return _floatValuesSliced[0];
+SliceView<float> Numeric::floatValues(){
+	return _floatValuesSliced.slice(0);
 }
 
-const std::vector<Imath::V3f> &Numeric::vec3Values(){
-	return _vec3ValuesSliced[0];
+SliceView<Imath::V3f> Numeric::vec3Values(){
+	return _vec3ValuesSliced.slice(0);
 }
 
-const std::vector<Imath::Color4f> &Numeric::col4Values(){
-	return _col4ValuesSliced[0];
+SliceView<Imath::Color4f> Numeric::col4Values(){
+	return _col4ValuesSliced.slice(0);
 }
 
-const std::vector<Imath::Quatf> &Numeric::quatValues(){
-	return _quatValuesSliced[0];
+SliceView<Imath::Quatf> Numeric::quatValues(){
+	return _quatValuesSliced.slice(0);
 }
 
-const std::vector<Imath::M44f> &Numeric::matrix44Values(){
-	return _matrix44ValuesSliced[0];
+SliceView<Imath::M44f> Numeric::matrix44Values(){
+	return _matrix44ValuesSliced.slice(0);
 }
 
 int Numeric::intValueAt(unsigned int id){
@@ -350,10 +413,12 @@ std::string Numeric::sliceAsString(unsigned int slice){
 		}
 
 		if(_type == numericTypeInt || _type == numericTypeIntArray){
-			for(int i = 0; i < _intValuesSliced[slice].size(); ++i){
-				stream << _intValuesSliced[slice][i];
+			SliceView<int> values = _intValuesSliced.slice(slice);
+			
+			for(int i = 0; i < values.size(); ++i){
+				stream << values[i];
 				
-				if(i < _intValuesSliced[slice].size() - 1){
+				if(i < values.size() - 1){
 					stream << ",";
 				}
 				
@@ -362,10 +427,12 @@ std::string Numeric::sliceAsString(unsigned int slice){
 			}
 		}
 		else if(_type == numericTypeFloat || _type == numericTypeFloatArray){
-			for(int i = 0; i < _floatValuesSliced[slice].size(); ++i){
-				stream << _floatValuesSliced[slice][i];
+			SliceView<float> values = _floatValuesSliced.slice(slice);
+			
+			for(int i = 0; i < values.size(); ++i){
+				stream << values[i];
 				
-				if(i < _floatValuesSliced[slice].size() - 1){
+				if(i < values.size() - 1){
 					stream << ",";
 				}
 				
@@ -374,15 +441,17 @@ std::string Numeric::sliceAsString(unsigned int slice){
 			}
 		}
 		else if(_type == numericTypeVec3 || _type == numericTypeVec3Array){
-			for(int i = 0; i < _vec3ValuesSliced[slice].size(); ++i){
+			SliceView<Imath::V3f> values = _vec3ValuesSliced.slice(slice);
+			
+			for(int i = 0; i < values.size(); ++i){
 				stream << "(";
-				Imath::V3f *vec = &_vec3ValuesSliced[slice][i];
+				const Imath::V3f *vec = &values[i];
 
 				stream << vec->x << ",";
 				stream << vec->y << ",";
 				stream << vec->z << ")";
 				
-				if(i < _vec3ValuesSliced[slice].size() - 1){
+				if(i < values.size() - 1){
 					stream << ",";
 				}
 				
@@ -391,16 +460,18 @@ std::string Numeric::sliceAsString(unsigned int slice){
 			}
 		}
 		else if(_type == numericTypeCol4 || _type == numericTypeCol4Array){
-			for(int i = 0; i < _col4ValuesSliced[slice].size(); ++i){
+			SliceView<Imath::Color4f> values = _col4ValuesSliced.slice(slice);
+			
+			for(int i = 0; i < values.size(); ++i){
 				stream << "(";
-				Imath::Color4f *col = &_col4ValuesSliced[slice][i];
+				const Imath::Color4f *col = &values[i];
 
 				stream << col->r << ",";
 				stream << col->g << ",";
 				stream << col->b << ",";
 				stream << col->a << ")";
 
-				if(i < _col4ValuesSliced[slice].size() - 1){
+				if(i < values.size() - 1){
 					stream << ",";
 				}
 
@@ -409,16 +480,18 @@ std::string Numeric::sliceAsString(unsigned int slice){
 			}
 		}
 		else if(_type == numericTypeQuat || _type == numericTypeQuatArray){
-			for(int i = 0; i < _quatValuesSliced[slice].size(); ++i){
+			SliceView<Imath::Quatf> values = _quatValuesSliced.slice(slice);
+			
+			for(int i = 0; i < values.size(); ++i){
 				stream << "(";
-				Imath::Quatf *quat = &_quatValuesSliced[slice][i];
+				const Imath::Quatf *quat = &values[i];
 
 				stream << quat->r << ",";
 				stream << quat->v.x << ",";
 				stream << quat->v.y << ",";
 				stream << quat->v.z << ")";
 
-				if(i < _quatValuesSliced[slice].size() - 1){
+				if(i < values.size() - 1){
 					stream << ",";
 				}
 
@@ -427,9 +500,11 @@ std::string Numeric::sliceAsString(unsigned int slice){
 			}
 		}
 		else if(_type == numericTypeMatrix44 || _type == numericTypeMatrix44Array){
-			for(int i = 0; i < _matrix44ValuesSliced[slice].size(); ++i){
+			SliceView<Imath::M44f> values = _matrix44ValuesSliced.slice(slice);
+			
+			for(int i = 0; i < values.size(); ++i){
 				stream << "(";
-				Imath::M44f *mat = &_matrix44ValuesSliced[slice][i];
+				const Imath::M44f *mat = &values[i];
 				
 				stream << mat->x[0][0] << ",";
 				stream << mat->x[0][1] << ",";
@@ -448,7 +523,7 @@ std::string Numeric::sliceAsString(unsigned int slice){
 				stream << mat->x[3][2] << ",";
 				stream << mat->x[3][3] << ")";
 				
-				if(i < _matrix44ValuesSliced.size() - 1){
+				if(i < _matrix44ValuesSliced.slices() - 1){
 					stream << ",";
 				}
 				
@@ -480,30 +555,33 @@ void Numeric::setFromString(const std::string &value){
 		Numeric::Type type = Numeric::Type(stringUtils::parseInt(fields[1]));
 		
 		if(type == Numeric::numericTypeInt || type == Numeric::numericTypeIntArray){
-			_intValuesSliced.resize(1);
-			_intValuesSliced[0].clear();
+			std::vector<int> parsedValues;
 
 			std::vector<std::string> values;
 			stringUtils::split(valuesStr, values, ",");
 			for(int i = 0; i < values.size(); ++i){
 				int value = stringUtils::parseInt(values[i]);
-				_intValuesSliced[0].push_back(value);
+				parsedValues.push_back(value);
 			}
+			
+			_intValuesSliced.resizeSlices(1, 0);
+			_intValuesSliced.setSlice(0, parsedValues);
 		}
 		else if(type == Numeric::numericTypeFloat || type == Numeric::numericTypeFloatArray){
-			_floatValuesSliced.resize(1);
-			_floatValuesSliced[0].clear();
+			std::vector<float> parsedValues;
 
 			std::vector<std::string> values;
 			stringUtils::split(valuesStr, values, ",");
 			for(int i = 0; i < values.size(); ++i){
 				float value = stringUtils::parseFloat(values[i]);
-				_floatValuesSliced[0].push_back(value);
+				parsedValues.push_back(value);
 			}
+			
+			_floatValuesSliced.resizeSlices(1, 0);
+			_floatValuesSliced.setSlice(0, parsedValues);
 		}
 		else if(type == Numeric::numericTypeVec3 || type == Numeric::numericTypeVec3Array){
-			_vec3ValuesSliced.resize(1);
-			_vec3ValuesSliced[0].clear();
+			std::vector<Imath::V3f> parsedValues;
 			
 			std::vector<std::string> values;
 			stringUtils::split(valuesStr, values, "),(");
@@ -519,13 +597,15 @@ void Numeric::setFromString(const std::string &value){
 					float z = stringUtils::parseFloat(numericValues[2]);
 					
 					Imath::V3f vec(x, y, z);
-					_vec3ValuesSliced[0].push_back(vec);
+					parsedValues.push_back(vec);
 				}
 			}
+			
+			_vec3ValuesSliced.resizeSlices(1, 0);
+			_vec3ValuesSliced.setSlice(0, parsedValues);
 		}
 		else if(type == Numeric::numericTypeQuat || type == Numeric::numericTypeQuatArray){
-			_quatValuesSliced.resize(1);
-			_quatValuesSliced[0].clear();
+			std::vector<Imath::Quatf> parsedValues;
 
 			std::vector<std::string> values;
 			stringUtils::split(valuesStr, values, "),(");
@@ -542,13 +622,15 @@ void Numeric::setFromString(const std::string &value){
 					float z = stringUtils::parseFloat(numericValues[3]);
 
 					Imath::Quatf vec(r, x, y, z);
-					_quatValuesSliced[0].push_back(vec);
+					parsedValues.push_back(vec);
 				}
 			}
+			
+			_quatValuesSliced.resizeSlices(1, 0);
+			_quatValuesSliced.setSlice(0, parsedValues);
 		}
 		else if(type == Numeric::numericTypeMatrix44 || type == Numeric::numericTypeMatrix44Array){
-			_matrix44ValuesSliced.resize(1);
-			_matrix44ValuesSliced[0].clear();
+			std::vector<Imath::M44f> parsedValues;
 			
 			std::vector<std::string> values;
 			stringUtils::split(valuesStr, values, "),(");
@@ -565,13 +647,15 @@ void Numeric::setFromString(const std::string &value){
 						stringUtils::parseFloat(numericValues[8]), stringUtils::parseFloat(numericValues[9]), stringUtils::parseFloat(numericValues[10]), stringUtils::parseFloat(numericValues[11]), 
 						stringUtils::parseFloat(numericValues[12]), stringUtils::parseFloat(numericValues[13]), stringUtils::parseFloat(numericValues[14]), stringUtils::parseFloat(numericValues[15]));
 					
-					_matrix44ValuesSliced[0].push_back(matrix);
+					parsedValues.push_back(matrix);
 				}
 			}
+			
+			_matrix44ValuesSliced.resizeSlices(1, 0);
+			_matrix44ValuesSliced.setSlice(0, parsedValues);
 		}
 		else if(type == Numeric::numericTypeCol4 || type == Numeric::numericTypeCol4Array){
-			_col4ValuesSliced.resize(1);
-			_col4ValuesSliced[0].clear();
+			std::vector<Imath::Color4f> parsedValues;
 			
 			std::vector<std::string> values;
 			stringUtils::split(valuesStr, values, "),(");
@@ -588,73 +672,62 @@ void Numeric::setFromString(const std::string &value){
 					float a = stringUtils::parseFloat(numericValues[3]);
 					
 					Imath::Color4f col(r, g, b, a);
-					_col4ValuesSliced[0].push_back(col);
+					parsedValues.push_back(col);
 				}
 			}
+			
+			_col4ValuesSliced.resizeSlices(1, 0);
+			_col4ValuesSliced.setSlice(0, parsedValues);
 		}
 	}
 }
 
 void Numeric::setIntValueAtSlice(unsigned int slice, unsigned int id, int value){
-	if(slice < _intValuesSliced.size()){
-		std::vector<int> &slicevec = _intValuesSliced[slice];
-		if(id < slicevec.size()){
-			slicevec[id] = value;
-		}
+	if(slice < _intValuesSliced.slices()){
+		_intValuesSliced.setValueAt(slice, id, value);
 	}
 }
 
 void Numeric::setFloatValueAtSlice(unsigned int slice, unsigned int id, float value){
-	if(slice < _floatValuesSliced.size()){
-		std::vector<float> &slicevec = _floatValuesSliced[slice];
-		if(id < slicevec.size()){
-			slicevec[id] = value;
-		}
+	if(slice < _floatValuesSliced.slices()){
+		_floatValuesSliced.setValueAt(slice, id, value);
 	}
 }
 
 void Numeric::setVec3ValueAtSlice(unsigned int slice, unsigned int id, const Imath::V3f &value){
-	if(slice < _vec3ValuesSliced.size()){
-		std::vector<Imath::V3f> &slicevec = _vec3ValuesSliced[slice];
-		if(id < slicevec.size()){
-			slicevec[id] = value;
-		}
+	if(slice < _vec3ValuesSliced.slices()){
+		_vec3ValuesSliced.setValueAt(slice, id, value);
 	}
 }
 
 void Numeric::setMatrix44ValueAtSlice(unsigned int slice, unsigned int id, const Imath::M44f &value){
-	if(slice < _matrix44ValuesSliced.size()){
-		std::vector<Imath::M44f> &slicevec = _matrix44ValuesSliced[slice];
-		if(id < slicevec.size()){
-			slicevec[id] = value;
-		}
+	if(slice < _matrix44ValuesSliced.slices()){
+		_matrix44ValuesSliced.setValueAt(slice, id, value);
 	}
 }
 
 void Numeric::setCol4ValueAtSlice(unsigned int slice, unsigned int id, const Imath::Color4f &value){
-	if(slice < _col4ValuesSliced.size()){
-		std::vector<Imath::Color4f> &slicevec = _col4ValuesSliced[slice];
-		if(id < slicevec.size()){
-			slicevec[id] = value;
-		}
+	if(slice < _col4ValuesSliced.slices()){
+		_col4ValuesSliced.setValueAt(slice, id, value);
 	}
 }
 
 void Numeric::setQuatValueAtSlice(unsigned int slice, unsigned int id, const Imath::Quatf &value){
-	if(slice < _quatValuesSliced.size()){
-		std::vector<Imath::Quatf> &slicevec = _quatValuesSliced[slice];
-		if(id < slicevec.size()){
-			slicevec[id] = value;
-		}
+	if(slice < _quatValuesSliced.slices()){
+		_quatValuesSliced.setValueAt(slice, id, value);
 	}
 }
 
 int Numeric::intValueAtSlice(unsigned int slice, unsigned int id){
-	if(slice >= _intValuesSliced.size()){
-		slice = _intValuesSliced.size() - 1;
+	if(slice >= _intValuesSliced.slices()){
+		slice = _intValuesSliced.slices() - 1;
+	}
+	
+	if(_intValuesSliced.isImplicit(slice)){
+		return _intValuesSliced.implicitValueAt(slice, id);
 	}
 
-	std::vector<int> &slicevec = _intValuesSliced[slice];
+	SliceView<int> slicevec = _intValuesSliced.slice(slice);
 
 	int size = slicevec.size();
 	if(id < size){
@@ -668,11 +741,15 @@ int Numeric::intValueAtSlice(unsigned int slice, unsigned int id){
 }
 
 float Numeric::floatValueAtSlice(unsigned int slice, unsigned int id){
-	if(slice >= _floatValuesSliced.size()){
-		slice = _floatValuesSliced.size() - 1;
+	if(slice >= _floatValuesSliced.slices()){
+		slice = _floatValuesSliced.slices() - 1;
+	}
+	
+	if(_floatValuesSliced.isImplicit(slice)){
+		return _floatValuesSliced.implicitValueAt(slice, id);
 	}
 
-	std::vector<float> &slicevec = _floatValuesSliced[slice];
+	SliceView<float> slicevec = _floatValuesSliced.slice(slice);
 
 	int size = slicevec.size();
 	if(id < size){
@@ -686,11 +763,15 @@ float Numeric::floatValueAtSlice(unsigned int slice, unsigned int id){
 }
 
 Imath::V3f Numeric::vec3ValueAtSlice(unsigned int slice, unsigned int id){
-	if(slice >= _vec3ValuesSliced.size()){
-		slice = _vec3ValuesSliced.size() - 1;
+	if(slice >= _vec3ValuesSliced.slices()){
+		slice = _vec3ValuesSliced.slices() - 1;
+	}
+	
+	if(_vec3ValuesSliced.isImplicit(slice)){
+		return _vec3ValuesSliced.implicitValueAt(slice, id);
 	}
 
-	std::vector<Imath::V3f> &slicevec = _vec3ValuesSliced[slice];
+	SliceView<Imath::V3f> slicevec = _vec3ValuesSliced.slice(slice);
 
 	int size = slicevec.size();
 	if(id < size){
@@ -704,11 +785,15 @@ Imath::V3f Numeric::vec3ValueAtSlice(unsigned int slice, unsigned int id){
 }
 
 Imath::Color4f Numeric::col4ValueAtSlice(unsigned int slice, unsigned int id){
-	if(slice >= _col4ValuesSliced.size()){
-		slice = _col4ValuesSliced.size() - 1;
+	if(slice >= _col4ValuesSliced.slices()){
+		slice = _col4ValuesSliced.slices() - 1;
+	}
+	
+	if(_col4ValuesSliced.isImplicit(slice)){
+		return _col4ValuesSliced.implicitValueAt(slice, id);
 	}
 
-	std::vector<Imath::Color4f> &slicevec = _col4ValuesSliced[slice];
+	SliceView<Imath::Color4f> slicevec = _col4ValuesSliced.slice(slice);
 
 	int size = slicevec.size();
 	if(id < size){
@@ -722,11 +807,15 @@ Imath::Color4f Numeric::col4ValueAtSlice(unsigned int slice, unsigned int id){
 }
 
 Imath::Quatf Numeric::quatValueAtSlice(unsigned int slice, unsigned int id){
-	if(slice >= _quatValuesSliced.size()){
-		slice = _quatValuesSliced.size() - 1;
+	if(slice >= _quatValuesSliced.slices()){
+		slice = _quatValuesSliced.slices() - 1;
+	}
+	
+	if(_quatValuesSliced.isImplicit(slice)){
+		return _quatValuesSliced.implicitValueAt(slice, id);
 	}
 
-	std::vector<Imath::Quatf> &slicevec = _quatValuesSliced[slice];
+	SliceView<Imath::Quatf> slicevec = _quatValuesSliced.slice(slice);
 
 	int size = slicevec.size();
 	if(id < size){
@@ -740,11 +829,15 @@ Imath::Quatf Numeric::quatValueAtSlice(unsigned int slice, unsigned int id){
 }
 
 Imath::M44f Numeric::matrix44ValueAtSlice(unsigned int slice, unsigned int id){
-	if(slice >= _matrix44ValuesSliced.size()){
-		slice = _matrix44ValuesSliced.size() - 1;
+	if(slice >= _matrix44ValuesSliced.slices()){
+		slice = _matrix44ValuesSliced.slices() - 1;
+	}
+	
+	if(_matrix44ValuesSliced.isImplicit(slice)){
+		return _matrix44ValuesSliced.implicitValueAt(slice, id);
 	}
 
-	std::vector<Imath::M44f> &slicevec = _matrix44ValuesSliced[slice];
+	SliceView<Imath::M44f> slicevec = _matrix44ValuesSliced.slice(slice);
 
 	int size = slicevec.size();
 	if(id < size){
@@ -758,87 +851,381 @@ Imath::M44f Numeric::matrix44ValueAtSlice(unsigned int slice, unsigned int id){
 }
 
 void Numeric::setIntValuesSlice(unsigned int slice, const std::vector<int> &values){
-	if(slice < _intValuesSliced.size()){
-		_intValuesSliced[slice] = values;
+	if(slice < _intValuesSliced.slices()){
+		_intValuesSliced.setSlice(slice, values);
 	}
 }
 
 void Numeric::setFloatValuesSlice(unsigned int slice, const std::vector<float> &values){
-	if(slice < _floatValuesSliced.size()){
-		_floatValuesSliced[slice] = values;
+	if(slice < _floatValuesSliced.slices()){
+		_floatValuesSliced.setSlice(slice, values);
 	}
 }
 
 void Numeric::setVec3ValuesSlice(unsigned int slice, const std::vector<Imath::V3f> &values){
-	if(slice < _vec3ValuesSliced.size()){
-		_vec3ValuesSliced[slice] = values;
+	if(slice < _vec3ValuesSliced.slices()){
+		_vec3ValuesSliced.setSlice(slice, values);
 	}
 }
 
 void Numeric::setQuatValuesSlice(unsigned int slice, const std::vector<Imath::Quatf> &values){
-	if(slice < _quatValuesSliced.size()){
-		_quatValuesSliced[slice] = values;
+	if(slice < _quatValuesSliced.slices()){
+		_quatValuesSliced.setSlice(slice, values);
 	}
 }
 
 void Numeric::setCol4ValuesSlice(unsigned int slice, const std::vector<Imath::Color4f> &values){
-	if(slice < _col4ValuesSliced.size()){
-		_col4ValuesSliced[slice] = values;
+	if(slice < _col4ValuesSliced.slices()){
+		_col4ValuesSliced.setSlice(slice, values);
 	}
 }
 
 void Numeric::setMatrix44ValuesSlice(unsigned int slice, const std::vector<Imath::M44f> &values){
-	if(slice < _matrix44ValuesSliced.size()){
-		_matrix44ValuesSliced[slice] = values;
+	if(slice < _matrix44ValuesSliced.slices()){
+		_matrix44ValuesSliced.setSlice(slice, values);
+	}
+}
+
+SliceView<int> Numeric::intValuesSlice(unsigned int slice){
+	if(slice >= _intValuesSliced.slices()){
+		slice = _intValuesSliced.slices() - 1;
+	}
+
+	return _intValuesSliced.slice(slice);
+}
+
+SliceView<float> Numeric::floatValuesSlice(unsigned int slice){
+	if(slice >= _floatValuesSliced.slices()){
+		slice = _floatValuesSliced.slices() - 1;
+	}
+
+	return _floatValuesSliced.slice(slice);
+}
+
+SliceView<Imath::V3f> Numeric::vec3ValuesSlice(unsigned int slice){
+	if(slice >= _vec3ValuesSliced.slices()){
+		slice = _vec3ValuesSliced.slices() - 1;
+	}
+
+	return _vec3ValuesSliced.slice(slice);
+}
+
+SliceView<Imath::Color4f> Numeric::col4ValuesSlice(unsigned int slice){
+	if(slice >= _col4ValuesSliced.slices()){
+		slice = _col4ValuesSliced.slices() - 1;
+	}
+
+	return _col4ValuesSliced.slice(slice);
+}
+
+SliceView<Imath::Quatf> Numeric::quatValuesSlice(unsigned int slice){
+	if(slice >= _quatValuesSliced.slices()){
+		slice = _quatValuesSliced.slices() - 1;
+	}
+
+	return _quatValuesSliced.slice(slice);
+}
+
+SliceView<Imath::M44f> Numeric::matrix44ValuesSlice(unsigned int slice){
+	if(slice >= _matrix44ValuesSliced.slices()){
+		slice = _matrix44ValuesSliced.slices() - 1;
+	}
+
+	return _matrix44ValuesSliced.slice(slice);
+}
+
+SliceWriter<int> Numeric::writeIntValuesSlice(unsigned int slice, unsigned int size){
+	if(slice >= _intValuesSliced.slices()){
+		slice = _intValuesSliced.slices() - 1;
+	}
+	
+	return SliceWriter<int>(_intValuesSliced, slice, size);
+}
+
+void Numeric::swapIntValuesSlice(unsigned int slice, std::vector<int> &values){
+	if(slice < _intValuesSliced.slices()){
+		_intValuesSliced.swapSlice(slice, values);
+	}
+}
+
+SliceWriter<float> Numeric::writeFloatValuesSlice(unsigned int slice, unsigned int size){
+	if(slice >= _floatValuesSliced.slices()){
+		slice = _floatValuesSliced.slices() - 1;
+	}
+	
+	return SliceWriter<float>(_floatValuesSliced, slice, size);
+}
+
+void Numeric::swapFloatValuesSlice(unsigned int slice, std::vector<float> &values){
+	if(slice < _floatValuesSliced.slices()){
+		_floatValuesSliced.swapSlice(slice, values);
+	}
+}
+
+SliceWriter<Imath::V3f> Numeric::writeVec3ValuesSlice(unsigned int slice, unsigned int size){
+	if(slice >= _vec3ValuesSliced.slices()){
+		slice = _vec3ValuesSliced.slices() - 1;
+	}
+	
+	return SliceWriter<Imath::V3f>(_vec3ValuesSliced, slice, size);
+}
+
+void Numeric::swapVec3ValuesSlice(unsigned int slice, std::vector<Imath::V3f> &values){
+	if(slice < _vec3ValuesSliced.slices()){
+		_vec3ValuesSliced.swapSlice(slice, values);
 	}
 }
 
-const std::vector<int> &Numeric::intValuesSlice(unsigned int slice){
-	if(slice >= _intValuesSliced.size()){
-		slice = _intValuesSliced.size() - 1;
+SliceWriter<Imath::M44f> Numeric::writeMatrix44ValuesSlice(unsigned int slice, unsigned int size){
+	if(slice >= _matrix44ValuesSliced.slices()){
+		slice = _matrix44ValuesSliced.slices() - 1;
 	}
+	
+	return SliceWriter<Imath::M44f>(_matrix44ValuesSliced, slice, size);
+}
+
+void Numeric::swapMatrix44ValuesSlice(unsigned int slice, std::vector<Imath::M44f> &values){
+	if(slice < _matrix44ValuesSliced.slices()){
+		_matrix44ValuesSliced.swapSlice(slice, values);
+	}
+}
+
+SliceWriter<Imath::Color4f> Numeric::writeCol4ValuesSlice(unsigned int slice, unsigned int size){
+	if(slice >= _col4ValuesSliced.slices()){
+		slice = _col4ValuesSliced.slices() - 1;
+	}
+	
+	return SliceWriter<Imath::Color4f>(_col4ValuesSliced, slice, size);
+}
+
+void Numeric::swapCol4ValuesSlice(unsigned int slice, std::vector<Imath::Color4f> &values){
+	if(slice < _col4ValuesSliced.slices()){
+		_col4ValuesSliced.swapSlice(slice, values);
+	}
+}
+
+SliceWriter<Imath::Quatf> Numeric::writeQuatValuesSlice(unsigned int slice, unsigned int size){
+	if(slice >= _quatValuesSliced.slices()){
+		slice = _quatValuesSliced.slices() - 1;
+	}
+	
+	return SliceWriter<Imath::Quatf>(_quatValuesSliced, slice, size);
+}
+
+void Numeric::swapQuatValuesSlice(unsigned int slice, std::vector<Imath::Quatf> &values){
+	if(slice < _quatValuesSliced.slices()){
+		_quatValuesSliced.swapSlice(slice, values);
+	}
+}
+
+void Numeric::shareValuesSlice(unsigned int slice, Numeric *other, unsigned int otherSlice){
+	Type type = other->_type;
+	if(type == numericTypeInt || type == numericTypeIntArray){
+		if(slice < _intValuesSliced.slices()){
+			_intValuesSliced.setSlice(slice, other->_intValuesSliced, std::min(otherSlice, other->_intValuesSliced.slices() - 1));
+		}
+	}
+	else if(type == numericTypeFloat || type == numericTypeFloatArray){
+		if(slice < _floatValuesSliced.slices()){
+			_floatValuesSliced.setSlice(slice, other->_floatValuesSliced, std::min(otherSlice, other->_floatValuesSliced.slices() - 1));
+		}
+	}
+	else if(type == numericTypeVec3 || type == numericTypeVec3Array){
+		if(slice < _vec3ValuesSliced.slices()){
+			_vec3ValuesSliced.setSlice(slice, other->_vec3ValuesSliced, std::min(otherSlice, other->_vec3ValuesSliced.slices() - 1));
+		}
+	}
+	else if(type == numericTypeMatrix44 || type == numericTypeMatrix44Array){
+		if(slice < _matrix44ValuesSliced.slices()){
+			_matrix44ValuesSliced.setSlice(slice, other->_matrix44ValuesSliced, std::min(otherSlice, other->_matrix44ValuesSliced.slices() - 1));
+		}
+	}
+	else if(type == numericTypeCol4 || type == numericTypeCol4Array){
+		if(slice < _col4ValuesSliced.slices()){
+			_col4ValuesSliced.setSlice(slice, other->_col4ValuesSliced, std::min(otherSlice, other->_col4ValuesSliced.slices() - 1));
+		}
+	}
+	else if(type == numericTypeQuat || type == numericTypeQuatArray){
+		if(slice < _quatValuesSliced.slices()){
+			_quatValuesSliced.setSlice(slice, other->_quatValuesSliced, std::min(otherSlice, other->_quatValuesSliced.slices() - 1));
+		}
+	}
+}
 
-	return _intValuesSliced[slice];
+void Numeric::setIntUniformSlice(unsigned int slice, int value, unsigned int size){
+	if(slice < _intValuesSliced.slices()){
+		_intValuesSliced.setUniformSlice(slice, value, size);
+	}
 }
 
-const std::vector<float> &Numeric::floatValuesSlice(unsigned int slice){
-	if(slice >= _floatValuesSliced.size()){
-		slice = _floatValuesSliced.size() - 1;
+void Numeric::setFloatUniformSlice(unsigned int slice, float value, unsigned int size){
+	if(slice < _floatValuesSliced.slices()){
+		_floatValuesSliced.setUniformSlice(slice, value, size);
 	}
+}
 
-	return _floatValuesSliced[slice];
+void Numeric::setVec3UniformSlice(unsigned int slice, const Imath::V3f &value, unsigned int size){
+	if(slice < _vec3ValuesSliced.slices()){
+		_vec3ValuesSliced.setUniformSlice(slice, value, size);
+	}
 }
 
-const std::vector<Imath::V3f> &Numeric::vec3ValuesSlice(unsigned int slice){
-	if(slice >= _vec3ValuesSliced.size()){
-		slice = _vec3ValuesSliced.size() - 1;
+void Numeric::setMatrix44UniformSlice(unsigned int slice, const Imath::M44f &value, unsigned int size){
+	if(slice < _matrix44ValuesSliced.slices()){
+		_matrix44ValuesSliced.setUniformSlice(slice, value, size);
 	}
+}
 
-	return _vec3ValuesSliced[slice];
+void Numeric::setCol4UniformSlice(unsigned int slice, const Imath::Color4f &value, unsigned int size){
+	if(slice < _col4ValuesSliced.slices()){
+		_col4ValuesSliced.setUniformSlice(slice, value, size);
+	}
 }
 
-const std::vector<Imath::Color4f> &Numeric::col4ValuesSlice(unsigned int slice){
-	if(slice >= _col4ValuesSliced.size()){
-		slice = _col4ValuesSliced.size() - 1;
+void Numeric::setQuatUniformSlice(unsigned int slice, const Imath::Quatf &value, unsigned int size){
+	if(slice < _quatValuesSliced.slices()){
+		_quatValuesSliced.setUniformSlice(slice, value, size);
 	}
+}
 
-	return _col4ValuesSliced[slice];
+void Numeric::setIntRangeSlice(unsigned int slice, int first, int step, unsigned int size){
+	if(slice < _intValuesSliced.slices()){
+		_intValuesSliced.setRangeSlice(slice, first, step, size);
+	}
 }
 
-const std::vector<Imath::Quatf> &Numeric::quatValuesSlice(unsigned int slice){
-	if(slice >= _quatValuesSliced.size()){
-		slice = _quatValuesSliced.size() - 1;
+void Numeric::setFloatRangeSlice(unsigned int slice, float first, float step, unsigned int size){
+	if(slice < _floatValuesSliced.slices()){
+		_floatValuesSliced.setRangeSlice(slice, first, step, size);
+	}
+}
+
+bool Numeric::isUniformSlice(unsigned int slice){
+	if(_type == numericTypeInt || _type == numericTypeIntArray){
+		return isImplicitSlice(_intValuesSliced, slice, false);
+	}
+	else if(_type == numericTypeFloat || _type == numericTypeFloatArray){
+		return isImplicitSlice(_floatValuesSliced, slice, false);
+	}
+	else if(_type == numericTypeVec3 || _type == numericTypeVec3Array){
+		return isImplicitSlice(_vec3ValuesSliced, slice, false);
+	}
+	else if(_type == numericTypeMatrix44 || _type == numericTypeMatrix44Array){
+		return isImplicitSlice(_matrix44ValuesSliced, slice, false);
+	}
+	else if(_type == numericTypeCol4 || _type == numericTypeCol4Array){
+		return isImplicitSlice(_col4ValuesSliced, slice, false);
+	}
+	else if(_type == numericTypeQuat || _type == numericTypeQuatArray){
+		return isImplicitSlice(_quatValuesSliced, slice, false);
+	}
+	
+	return false;
+}
+
+bool Numeric::isRangeSlice(unsigned int slice){
+	if(_type == numericTypeInt || _type == numericTypeIntArray){
+		return isImplicitSlice(_intValuesSliced, slice, true);
+	}
+	else if(_type == numericTypeFloat || _type == numericTypeFloatArray){
+		return isImplicitSlice(_floatValuesSliced, slice, true);
+	}
+	else if(_type == numericTypeVec3 || _type == numericTypeVec3Array){
+		return isImplicitSlice(_vec3ValuesSliced, slice, true);
 	}
+	else if(_type == numericTypeMatrix44 || _type == numericTypeMatrix44Array){
+		return isImplicitSlice(_matrix44ValuesSliced, slice, true);
+	}
+	else if(_type == numericTypeCol4 || _type == numericTypeCol4Array){
+		return isImplicitSlice(_col4ValuesSliced, slice, true);
+	}
+	else if(_type == numericTypeQuat || _type == numericTypeQuatArray){
+		return isImplicitSlice(_quatValuesSliced, slice, true);
+	}
+	
+	return false;
+}
+
+int Numeric::intRangeStepSlice(unsigned int slice){
+	return rangeStepSlice(_intValuesSliced, slice);
+}
 
-	return _quatValuesSliced[slice];
+float Numeric::floatRangeStepSlice(unsigned int slice){
+	return rangeStepSlice(_floatValuesSliced, slice);
 }
 
-const std::vector<Imath::M44f> &Numeric::matrix44ValuesSlice(unsigned int slice){
-	if(slice >= _matrix44ValuesSliced.size()){
-		slice = _matrix44ValuesSliced.size() - 1;
+bool Numeric::mapValuesSlice(unsigned int slice, const std::string &filename){
+	if(!_isArray || slice >= _slices){
+		return false;
+	}
+	
+	boost::shared_ptr<MappedFile> file(new MappedFile(filename, MappedFile::modeRead));
+	if(!file->isValid()){
+		return false;
+	}
+	
+	if(_type == numericTypeIntArray){
+		_intValuesSliced.setMappedSlice(slice, file);
+	}
+	else if(_type == numericTypeFloatArray){
+		_floatValuesSliced.setMappedSlice(slice, file);
+	}
+	else if(_type == numericTypeVec3Array){
+		_vec3ValuesSliced.setMappedSlice(slice, file);
+	}
+	else if(_type == numericTypeMatrix44Array){
+		_matrix44ValuesSliced.setMappedSlice(slice, file);
+	}
+	else if(_type == numericTypeCol4Array){
+		_col4ValuesSliced.setMappedSlice(slice, file);
+	}
+	else if(_type == numericTypeQuatArray){
+		_quatValuesSliced.setMappedSlice(slice, file);
+	}
+	
+	return true;
+}
+
+bool Numeric::isMappedSlice(unsigned int slice){
+	if(slice >= _slices){
+		slice = _slices - 1;
+	}
+	
+	if(_type == numericTypeIntArray){
+		return _intValuesSliced.isMapped(slice);
+	}
+	else if(_type == numericTypeFloatArray){
+		return _floatValuesSliced.isMapped(slice);
+	}
+	else if(_type == numericTypeVec3Array){
+		return _vec3ValuesSliced.isMapped(slice);
+	}
+	else if(_type == numericTypeMatrix44Array){
+		return _matrix44ValuesSliced.isMapped(slice);
 	}
+	else if(_type == numericTypeCol4Array){
+		return _col4ValuesSliced.isMapped(slice);
+	}
+	else if(_type == numericTypeQuatArray){
+		return _quatValuesSliced.isMapped(slice);
+	}
+	
+	return false;
+}
+
+void Numeric::setMappedStorage(const std::string &directory){
+	_mappedStorage = directory;
+	
+	_intValuesSliced.setMappedStorage(directory);
+	_floatValuesSliced.setMappedStorage(directory);
+	_vec3ValuesSliced.setMappedStorage(directory);
+	_matrix44ValuesSliced.setMappedStorage(directory);
+	_col4ValuesSliced.setMappedStorage(directory);
+	_quatValuesSliced.setMappedStorage(directory);
+}
 
-	return _matrix44ValuesSliced[slice];
+const std::string &Numeric::mappedStorage(){
+	return _mappedStorage;
 }
 
 void Numeric::resizeSlices(unsigned int slices){
@@ -848,78 +1235,125 @@ void Numeric::resizeSlices(unsigned int slices){
 
 	if(slices != _slices && _type != numericTypeAny){
 		if(_type == numericTypeInt){
-			_intValuesSliced.resize(slices);
+			_intValuesSliced.resizeSlices(slices, 1);
 			for(int i = 0; i < slices; ++i){
-				std::vector<int> &slicevec = _intValuesSliced[i];
-				if(!slicevec.size()){
-					slicevec.resize(1);
+				if(!_intValuesSliced.sizeSlice(i)){
+					_intValuesSliced.resizeSlice(i, 1);
 				}
 			}
 		}
 		else if(_type == numericTypeIntArray){
-			_intValuesSliced.resize(slices);
+			_intValuesSliced.resizeSlices(slices, 0);
 		}
 		else if(_type == numericTypeFloat){
-			_floatValuesSliced.resize(slices);
+			_floatValuesSliced.resizeSlices(slices, 1);
 			for(int i = 0; i < slices; ++i){
-				std::vector<float> &slicevec = _floatValuesSliced[i];
-				if(!slicevec.size()){
-					slicevec.resize(1);
+				if(!_floatValuesSliced.sizeSlice(i)){
+					_floatValuesSliced.resizeSlice(i, 1);
 				}
 			}
 		}
 		else if(_type == numericTypeFloatArray){
-			_floatValuesSliced.resize(slices);
+			_floatValuesSliced.resizeSlices(slices, 0);
 		}
 		else if(_type == numericTypeVec3){
-			_vec3ValuesSliced.resize(slices);
+			_vec3ValuesSliced.resizeSlices(slices, 1);
 			for(int i = 0; i < slices; ++i){
-				std::vector<Imath::V3f> &slicevec = _vec3ValuesSliced[i];
-				if(!slicevec.size()){
-					slicevec.resize(1);
+				if(!_vec3ValuesSliced.sizeSlice(i)){
+					_vec3ValuesSliced.resizeSlice(i, 1);
 				}
 			}
 		}
 		else if(_type == numericTypeVec3Array){
-			_vec3ValuesSliced.resize(slices);
+			_vec3ValuesSliced.resizeSlices(slices, 0);
 		}
 		else if(_type == numericTypeQuat){
-			_quatValuesSliced.resize(slices);
+			_quatValuesSliced.resizeSlices(slices, 1);
 			for(int i = 0; i < slices; ++i){
-				std::vector<Imath::Quatf> &slicevec = _quatValuesSliced[i];
-				if(!slicevec.size()){
-					slicevec.resize(1);
+				if(!_quatValuesSliced.sizeSlice(i)){
+					_quatValuesSliced.resizeSlice(i, 1);
 				}
 			}
 		}
 		else if(_type == numericTypeQuatArray){
-			_quatValuesSliced.resize(slices);
+			_quatValuesSliced.resizeSlices(slices, 0);
 		}
 		else if(_type == numericTypeMatrix44){
-			_matrix44ValuesSliced.resize(slices);
+			_matrix44ValuesSliced.resizeSlices(slices, 1);
 			for(int i = 0; i < slices; ++i){
-				std::vector<Imath::M44f> &slicevec = _matrix44ValuesSliced[i];
-				if(!slicevec.size()){
-					slicevec.resize(1);
+				if(!_matrix44ValuesSliced.sizeSlice(i)){
+					_matrix44ValuesSliced.resizeSlice(i, 1);
 				}
 			}
 		}
 		else if(_type == numericTypeMatrix44Array){
-			_matrix44ValuesSliced.resize(slices);
+			_matrix44ValuesSliced.resizeSlices(slices, 0);
 		}
 		else if(_type == numericTypeCol4){
-			_col4ValuesSliced.resize(slices);
+			_col4ValuesSliced.resizeSlices(slices, 1);
 			for(int i = 0; i < slices; ++i){
-				std::vector<Imath::Color4f> &slicevec = _col4ValuesSliced[i];
-				if(!slicevec.size()){
-					slicevec.resize(1);
+				if(!_col4ValuesSliced.sizeSlice(i)){
+					_col4ValuesSliced.resizeSlice(i, 1);
 				}
 			}
 		}
 		else if(_type == numericTypeCol4Array){
-			_col4ValuesSliced.resize(slices);
+			_col4ValuesSliced.resizeSlices(slices, 0);
 		}
 
 		_slices = slices;
 	}
+	
+	// slices are written concurrently from here on, they can't share the inline buffer with another Numeric.
+	_intValuesSliced.prepareWrite();
+	_floatValuesSliced.prepareWrite();
+	_vec3ValuesSliced.prepareWrite();
+	_col4ValuesSliced.prepareWrite();
+	_quatValuesSliced.prepareWrite();
+	_matrix44ValuesSliced.prepareWrite();
+	
+	// only arrays hold implicit or mapped slices
+	if(_slices > 1){
+		if(_type == numericTypeIntArray){
+			_intValuesSliced.prepareSliceForms();
+		}
+		else if(_type == numericTypeFloatArray){
+			_floatValuesSliced.prepareSliceForms();
+		}
+		else if(_type == numericTypeVec3Array){
+			_vec3ValuesSliced.prepareSliceForms();
+		}
+		else if(_type == numericTypeMatrix44Array){
+			_matrix44ValuesSliced.prepareSliceForms();
+		}
+		else if(_type == numericTypeCol4Array){
+			_col4ValuesSliced.prepareSliceForms();
+		}
+		else if(_type == numericTypeQuatArray){
+			_quatValuesSliced.prepareSliceForms();
+		}
+	}
+}
+
+bool Numeric::contentHash(std::size_t &hash){
+	hash = hashBytes(&_type, sizeof(Type), 0);
+	hash = hashBytes(&_slices, sizeof(unsigned int), hash);
+	
+	hashSlices(_intValuesSliced, hash);
+	hashSlices(_floatValuesSliced, hash);
+	hashSlices(_vec3ValuesSliced, hash);
+	hashSlices(_col4ValuesSliced, hash);
+	hashSlices(_quatValuesSliced, hash);
+	hashSlices(_matrix44ValuesSliced, hash);
+	
+	return true;
+}
+
+std::size_t Numeric::sizeInBytes(){
+	return _intValuesSliced.sizeInBytes() + 
+		_floatValuesSliced.sizeInBytes() + 
+		_vec3ValuesSliced.sizeInBytes() + 
+		_col4ValuesSliced.sizeInBytes() + 
+		_quatValuesSliced.sizeInBytes() + 
+		_matrix44ValuesSliced.sizeInBytes();
 }
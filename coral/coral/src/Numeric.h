@@ -40,12 +40,17 @@
 #include <ImathQuat.h>
 
 #include "Value.h"
+#include "SlicedValues.h"
 
 namespace coral{
 
 class NumericOperation;
 
 //! A dynamic class that wraps all the available numerical types, used by NumericAttribute.
+//
+//! The values of all the slices are kept in a SlicedValues: single values are stored contiguously, one per slice, 
+//! and copying a Numeric shares its buffers until one of the copies is written to.
+//! Values read from a Numeric are returned as a SliceView, it stays valid until the Numeric is modified.
 class CORAL_EXPORT Numeric : public Value{
 
 public:
@@ -67,6 +72,7 @@ public:
 
 	Numeric();
 	void copy(const Value *other);
+	Value *duplicate();
 	Numeric::Type type();
 	void setType(Numeric::Type type);
 	bool isArray();
@@ -78,12 +84,12 @@ public:
 	void setCol4ValueAt(unsigned int id, const Imath::Color4f &value);
 	void setQuatValueAt(unsigned int id, const Imath::Quatf &value);
 	void setMatrix44ValueAt(unsigned int id, const Imath::M44f &value);
-	const std::vector<int> &intValues();
-	const std::vector<float> &floatValues();
-	const std::vector<Imath::V3f> &vec3Values();
-	const std::vector<Imath::Color4f> &col4Values();
-	const std::vector<Imath::Quatf> &quatValues();
-	const std::vector<Imath::M44f> &matrix44Values();
+	SliceView<int> intValues();
+	SliceView<float> floatValues();
+	SliceView<Imath::V3f> vec3Values();
+	SliceView<Imath::Color4f> col4Values();
+	SliceView<Imath::Quatf> quatValues();
+	SliceView<Imath::M44f> matrix44Values();
 	int intValueAt(unsigned int id);
 	float floatValueAt(unsigned int id);
 	Imath::V3f vec3ValueAt(unsigned int id);
@@ -122,26 +128,76 @@ public:
 	void setMatrix44ValuesSlice(unsigned int slice, const std::vector<Imath::M44f> &values);
 	void setCol4ValuesSlice(unsigned int slice, const std::vector<Imath::Color4f> &values);
 	void setQuatValuesSlice(unsigned int slice, const std::vector<Imath::Quatf> &values);
-	const std::vector<int> &intValuesSlice(unsigned int slice);
-	const std::vector<float> &floatValuesSlice(unsigned int slice);
-	const std::vector<Imath::V3f> &vec3ValuesSlice(unsigned int slice);
-	const std::vector<Imath::M44f> &matrix44ValuesSlice(unsigned int slice);
-	const std::vector<Imath::Quatf> &quatValuesSlice(unsigned int slice);
-	const std::vector<Imath::Color4f> &col4ValuesSlice(unsigned int slice);
+	SliceView<int> intValuesSlice(unsigned int slice);
+	SliceView<float> floatValuesSlice(unsigned int slice);
+	SliceView<Imath::V3f> vec3ValuesSlice(unsigned int slice);
+	SliceView<Imath::M44f> matrix44ValuesSlice(unsigned int slice);
+	SliceView<Imath::Quatf> quatValuesSlice(unsigned int slice);
+	SliceView<Imath::Color4f> col4ValuesSlice(unsigned int slice);
+	
+	//! Resizes the values of slice in place and returns them to be written directly, without building a temporary vector.
+	//! The writer is valid until the Numeric is resized or written through any other method.
+	SliceWriter<int> writeIntValuesSlice(unsigned int slice, unsigned int size);
+	SliceWriter<float> writeFloatValuesSlice(unsigned int slice, unsigned int size);
+	SliceWriter<Imath::V3f> writeVec3ValuesSlice(unsigned int slice, unsigned int size);
+	SliceWriter<Imath::M44f> writeMatrix44ValuesSlice(unsigned int slice, unsigned int size);
+	SliceWriter<Imath::Color4f> writeCol4ValuesSlice(unsigned int slice, unsigned int size);
+	SliceWriter<Imath::Quatf> writeQuatValuesSlice(unsigned int slice, unsigned int size);
+	
+	//! Moves values into slice by exchanging the buffers, values is left holding the previous content of the slice, ready to be reused.
+	void swapIntValuesSlice(unsigned int slice, std::vector<int> &values);
+	void swapFloatValuesSlice(unsigned int slice, std::vector<float> &values);
+	void swapVec3ValuesSlice(unsigned int slice, std::vector<Imath::V3f> &values);
+	void swapMatrix44ValuesSlice(unsigned int slice, std::vector<Imath::M44f> &values);
+	void swapCol4ValuesSlice(unsigned int slice, std::vector<Imath::Color4f> &values);
+	void swapQuatValuesSlice(unsigned int slice, std::vector<Imath::Quatf> &values);
+	
+	//! Sets slice to the values of otherSlice of other, in the type other currently holds. 
+	//! The buffer of an array is shared until one of the two is written, no value is copied.
+	void shareValuesSlice(unsigned int slice, Numeric *other, unsigned int otherSlice);
+	
+	//! Implicit slices: size copies of one value, or an arithmetic range for int and float slices, stored without their values.
+	//! They are expanded only when their values are read through *ValuesSlice() or *Values(), 
+	//! kernels can check isUniformSlice() and isRangeSlice() to work on the compact form instead.
+	void setIntUniformSlice(unsigned int slice, int value, unsigned int size);
+	void setFloatUniformSlice(unsigned int slice, float value, unsigned int size);
+	void setVec3UniformSlice(unsigned int slice, const Imath::V3f &value, unsigned int size);
+	void setMatrix44UniformSlice(unsigned int slice, const Imath::M44f &value, unsigned int size);
+	void setCol4UniformSlice(unsigned int slice, const Imath::Color4f &value, unsigned int size);
+	void setQuatUniformSlice(unsigned int slice, const Imath::Quatf &value, unsigned int size);
+	void setIntRangeSlice(unsigned int slice, int first, int step, unsigned int size);
+	void setFloatRangeSlice(unsigned int slice, float first, float step, unsigned int size);
+	bool isUniformSlice(unsigned int slice);
+	bool isRangeSlice(unsigned int slice);
+	int intRangeStepSlice(unsigned int slice);
+	float floatRangeStepSlice(unsigned int slice);
+	
+	//! Out of core arrays: mapValuesSlice() reads the values of slice straight from filename, a raw array of the current type, 
+	//! loading the pages of the file only as they're accessed. Returns false if this is not an array or the file can't be mapped.
+	//! setMappedStorage() makes slices bigger than SlicedValues::mappedStorageMinBytes live in scratch files created in directory 
+	//! instead of memory, an empty directory brings them back to memory as they get written.
+	bool mapValuesSlice(unsigned int slice, const std::string &filename);
+	bool isMappedSlice(unsigned int slice);
+	void setMappedStorage(const std::string &directory);
+	const std::string &mappedStorage();
+	
 	std::string sliceAsString(unsigned int slice);
+	bool contentHash(std::size_t &hash);
+	std::size_t sizeInBytes();
 
 private:
 	friend class NumericOperation;
 	
-	std::vector<std::vector<int> > _intValuesSliced;
-	std::vector<std::vector<float> > _floatValuesSliced;
-	std::vector<std::vector<Imath::V3f> > _vec3ValuesSliced;
-	std::vector<std::vector<Imath::Color4f> > _col4ValuesSliced;
-	std::vector<std::vector<Imath::M44f> > _matrix44ValuesSliced;
-	std::vector<std::vector<Imath::Quatf> > _quatValuesSliced;
+	SlicedValues<int> _intValuesSliced;
+	SlicedValues<float> _floatValuesSliced;
+	SlicedValues<Imath::V3f> _vec3ValuesSliced;
+	SlicedValues<Imath::Color4f> _col4ValuesSliced;
+	SlicedValues<Imath::M44f> _matrix44ValuesSliced;
+	SlicedValues<Imath::Quatf> _quatValuesSliced;
 	bool _isArray;
 	Type _type;	
 	unsigned int _slices;
+	std::string _mappedStorage;
 };
 
 }
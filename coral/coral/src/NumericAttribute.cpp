@@ -58,6 +58,14 @@ Numeric *NumericAttribute::outValue(){
 	return (Numeric*)Attribute::outValue();
 }
 
+void NumericAttribute::setMappedStorage(const std::string &directory){
+	outValue()->setMappedStorage(directory);
+}
+
+std::string NumericAttribute::mappedStorage(){
+	return outValue()->mappedStorage();
+}
+
 void NumericAttribute::onSettingSpecialization(const std::vector<std::string> &specialization){
 	if(specialization.size() == 1){
 		std::string typeStr = specialization[0];
@@ -44,6 +44,11 @@ public:
 	
 	Numeric *value();
 	Numeric *outValue();
+	
+	//! Big arrays computed for this attribute are kept in scratch files created in directory rather than in memory, 
+	//! see Numeric::setMappedStorage(). An empty directory, the default, keeps them in memory.
+	void setMappedStorage(const std::string &directory);
+	std::string mappedStorage();
 
 	void onSettingSpecialization(const std::vector<std::string> &specialization);
 	static Numeric::Type numericTypeFromString(const std::string &typeStr);
@@ -42,6 +42,7 @@ public:
 	Object();
 	virtual ~Object();
 	
+	//! Unique for the whole session, 0 if NetworkManager ran out of ids when this object was created: it can't be found by id or handed to python.
 	int id();
 	void addReference();
 	void removeReference();
@@ -0,0 +1,263 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+#ifdef CORAL_PARALLEL_TBB
+	#include <tbb/enumerable_thread_specific.h>
+	#include <tbb/atomic.h>
+	#include <tbb/tick_count.h>
+#endif
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <vector>
+#include <map>
+#include <fstream>
+
+#include "Profiler.h"
+#include "Attribute.h"
+#include "Node.h"
+#include "NetworkManager.h"
+#include "EvaluationPlan.h"
+#include "stringUtils.h"
+
+using namespace coral;
+
+bool Profiler::_enabled = false;
+
+namespace {
+	struct ProfilerSpan{
+		Profiler::SpanType type;
+		int nodeId;
+		int attributeId;
+		int slice;
+		int level;
+		double start;
+		double end;
+	};
+	
+	struct ThreadSpans{
+		ThreadSpans(): thread(0){
+		}
+		
+		int thread;
+		std::vector<ProfilerSpan> spans;
+	};
+	
+	bool _started = false;
+	
+	#ifdef CORAL_PARALLEL_TBB
+		tbb::enumerable_thread_specific<ThreadSpans> _threadSpans;
+		tbb::atomic<int> _threadCount;
+		tbb::tick_count _startTick;
+	#else
+		ThreadSpans _threadSpans;
+		boost::posix_time::ptime _startTime;
+	#endif
+	
+	ThreadSpans &localSpans(){
+		#ifdef CORAL_PARALLEL_TBB
+			bool exists = false;
+			ThreadSpans &threadSpans = _threadSpans.local(exists);
+			if(!exists){
+				threadSpans.thread = _threadCount++;
+			}
+			
+			return threadSpans;
+		#else
+			return _threadSpans;
+		#endif
+	}
+	
+	void collectThreadSpans(std::vector<ThreadSpans*> &threadSpans){
+		#ifdef CORAL_PARALLEL_TBB
+			for(tbb::enumerable_thread_specific<ThreadSpans>::iterator it = _threadSpans.begin(); it != _threadSpans.end(); ++it){
+				threadSpans.push_back(&(*it));
+			}
+		#else
+			threadSpans.push_back(&_threadSpans);
+		#endif
+	}
+	
+	std::string jsonString(const std::string &value){
+		std::string str = "\"";
+		for(int i = 0; i < value.size(); ++i){
+			char c = value[i];
+			if(c == '"' || c == '\\'){
+				str += '\\';
+			}
+			str += c;
+		}
+		str += "\"";
+		
+		return str;
+	}
+	
+	std::string objectName(int id, std::map<int, std::string> &names){
+		std::map<int, std::string>::iterator it = names.find(id);
+		if(it != names.end()){
+			return it->second;
+		}
+		
+		std::string name;
+		NestedObject *object = (NestedObject*)NetworkManager::findObjectById(id);
+		if(object && !object->isDeleted()){
+			name = object->fullName();
+		}
+		else{
+			name = "deleted object " + stringUtils::intToString(id);
+		}
+		
+		names[id] = name;
+		
+		return name;
+	}
+}
+
+void Profiler::setEnabled(bool value){
+	if(value && !_started){
+		#ifdef CORAL_PARALLEL_TBB
+			_startTick = tbb::tick_count::now();
+		#else
+			_startTime = boost::posix_time::microsec_clock::universal_time();
+		#endif
+		
+		_started = true;
+	}
+	
+	_enabled = value;
+}
+
+void Profiler::clear(){
+	std::vector<ThreadSpans*> threadSpans;
+	collectThreadSpans(threadSpans);
+	
+	for(int i = 0; i < threadSpans.size(); ++i){
+		std::vector<ProfilerSpan>().swap(threadSpans[i]->spans);
+	}
+}
+
+int Profiler::spanCount(){
+	std::vector<ThreadSpans*> threadSpans;
+	collectThreadSpans(threadSpans);
+	
+	int count = 0;
+	for(int i = 0; i < threadSpans.size(); ++i){
+		count += threadSpans[i]->spans.size();
+	}
+	
+	return count;
+}
+
+double Profiler::now(){
+	#ifdef CORAL_PARALLEL_TBB
+		return (tbb::tick_count::now() - _startTick).seconds() * 1000000.0;
+	#else
+		boost::posix_time::ptime time = boost::posix_time::microsec_clock::universal_time();
+		return double(boost::posix_time::time_period(_startTime, time).length().total_microseconds());
+	#endif
+}
+
+int Profiler::levelOf(Attribute *attribute){
+	if(attribute->_evaluationPlan){
+		return attribute->_evaluationPlan->levelAt(attribute->_planIndex);
+	}
+	
+	return -1;
+}
+
+void Profiler::addSpan(SpanType type, Attribute *attribute, int slice, double start, double end){
+	Node *parentNode = attribute->parent();
+	
+	ProfilerSpan span;
+	span.type = type;
+	span.nodeId = parentNode ? parentNode->id() : -1;
+	span.attributeId = attribute->id();
+	span.slice = slice;
+	span.level = levelOf(attribute);
+	span.start = start;
+	span.end = end;
+	
+	localSpans().spans.push_back(span);
+}
+
+bool Profiler::writeChromeTrace(const std::string &filename){
+	std::ofstream file(filename.c_str());
+	if(!file){
+		return false;
+	}
+	
+	file.setf(std::ios::fixed);
+	file.precision(3);
+	
+	std::vector<ThreadSpans*> threadSpans;
+	collectThreadSpans(threadSpans);
+	
+	std::map<int, std::string> names;
+	bool first = true;
+	
+	file << "{\"traceEvents\": [" << std::endl;
+	for(int i = 0; i < threadSpans.size(); ++i){
+		int thread = threadSpans[i]->thread;
+		
+		if(!first){
+			file << "," << std::endl;
+		}
+		first = false;
+		
+		file << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << thread;
+		file << ", \"args\": {\"name\": \"thread " << thread << "\"}}";
+		
+		const std::vector<ProfilerSpan> &spans = threadSpans[i]->spans;
+		for(int j = 0; j < spans.size(); ++j){
+			const ProfilerSpan &span = spans[j];
+			
+			std::string name;
+			std::string category;
+			if(span.type == spanTypeEvaluation){
+				name = "clean " + objectName(span.attributeId, names);
+				category = "evaluation";
+			}
+			else{
+				name = span.nodeId != -1 ? objectName(span.nodeId, names) : objectName(span.attributeId, names);
+				category = span.type == spanTypeNodeUpdate ? "node" : "slice";
+			}
+			
+			file << "," << std::endl;
+			file << "{\"name\": " << jsonString(name) << ", \"cat\": \"" << category << "\", \"ph\": \"X\"";
+			file << ", \"ts\": " << span.start << ", \"dur\": " << span.end - span.start;
+			file << ", \"pid\": 1, \"tid\": " << thread;
+			file << ", \"args\": {\"attribute\": " << jsonString(objectName(span.attributeId, names)) << ", \"level\": " << span.level;
+			if(span.type == spanTypeSlice){
+				file << ", \"slice\": " << span.slice;
+			}
+			file << "}}";
+		}
+	}
+	file << std::endl << "], \"displayTimeUnit\": \"ms\"}" << std::endl;
+	
+	return true;
+}
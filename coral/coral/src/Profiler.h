@@ -0,0 +1,109 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+
+#ifndef CORAL_PROFILER_H
+#define CORAL_PROFILER_H
+
+#include <string>
+#include "coralDefinitions.h"
+
+namespace coral{
+class Attribute;
+
+//! Records the spans of each evaluation to find hot nodes and scheduling gaps across threads.
+//
+//! Recording is off by default. Once enabled each thread appends its spans to a buffer of its own and 
+//! spans are resolved to names only when they are written out, so the profiler can be left on during playback.
+//! clear() and writeChromeTrace() must not be called while an evaluation is running.
+class CORAL_EXPORT Profiler{
+public:
+	enum SpanType{
+		spanTypeEvaluation = 0,
+		spanTypeNodeUpdate,
+		spanTypeSlice
+	};
+	
+	static void setEnabled(bool value);
+	static bool isEnabled(){
+		return _enabled;
+	}
+	
+	//! Discards the spans recorded so far.
+	static void clear();
+	static int spanCount();
+	
+	//! Writes the recorded spans to filename in the Chrome trace event format, it can be loaded in chrome://tracing.
+	static bool writeChromeTrace(const std::string &filename);
+	
+	//! Microseconds elapsed since the profiler was first enabled.
+	static double now();
+	
+	//! Records a span of the given type on the calling thread, slice is -1 for spans that are not of type spanTypeSlice.
+	static void addSpan(SpanType type, Attribute *attribute, int slice, double start, double end);
+
+private:
+	static bool _enabled;
+	
+	static int levelOf(Attribute *attribute);
+};
+
+//! Records a span from its construction to its destruction if the Profiler is enabled.
+class ProfilerScope{
+public:
+	ProfilerScope(Profiler::SpanType type, Attribute *attribute, int slice = -1):
+		_enabled(Profiler::isEnabled()),
+		_type(type),
+		_attribute(attribute),
+		_slice(slice),
+		_start(0.0){
+		if(_enabled){
+			_start = Profiler::now();
+		}
+	}
+	
+	~ProfilerScope(){
+		if(_enabled){
+			Profiler::addSpan(_type, _attribute, _slice, _start, Profiler::now());
+		}
+	}
+
+private:
+	bool _enabled;
+	Profiler::SpanType _type;
+	Attribute *_attribute;
+	int _slice;
+	double _start;
+	
+	ProfilerScope(const ProfilerScope &other);
+	ProfilerScope &operator =(const ProfilerScope &other);
+};
+
+}
+
+#endif
@@ -0,0 +1,139 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+
+#ifndef CORAL_SHAREDVECTOR_H
+#define CORAL_SHAREDVECTOR_H
+
+#include <vector>
+#include <boost/shared_ptr.hpp>
+
+namespace coral{
+
+//! A std::vector shared by reference between copies until one of them writes to it.
+//
+//! Copying a SharedVector only copies a reference to its buffer, the buffer gets duplicated 
+//! the first time write() is called on a copy while the buffer is still shared, copy on write.
+//! Concurrent writes to different SharedVector objects are safe even when they share their buffer, 
+//! writing the same object from more threads is not, same as for std::vector.
+template<class T>
+class SharedVector{
+public:
+	SharedVector(){
+	}
+	
+	SharedVector(const std::vector<T> &values): _buffer(new std::vector<T>(values)){
+	}
+	
+	const std::vector<T> &read() const{
+		if(_buffer){
+			return *_buffer;
+		}
+		
+		static const std::vector<T> empty;
+		return empty;
+	}
+	
+	//! Returns a buffer owned by this object only, to be modified in place.
+	std::vector<T> &write(){
+		if(!_buffer){
+			_buffer = boost::shared_ptr<std::vector<T> >(new std::vector<T>());
+		}
+		else if(!_buffer.unique()){
+			_buffer = boost::shared_ptr<std::vector<T> >(new std::vector<T>(*_buffer));
+		}
+		
+		return *_buffer;
+	}
+	
+	//! Replaces the content, a shared buffer is left to its other owners rather than copied first.
+	void assign(const std::vector<T> &values){
+		if(_buffer && _buffer.unique()){
+			*_buffer = values;
+		}
+		else{
+			_buffer = boost::shared_ptr<std::vector<T> >(new std::vector<T>(values));
+		}
+	}
+	
+	unsigned int size() const{
+		if(_buffer){
+			return _buffer->size();
+		}
+		
+		return 0;
+	}
+	
+	std::size_t capacity() const{
+		if(_buffer){
+			return _buffer->capacity();
+		}
+		
+		return 0;
+	}
+	
+	void resize(unsigned int newSize){
+		if(newSize != size()){
+			if(_buffer && !_buffer.unique() && newSize < size()){
+				_buffer = boost::shared_ptr<std::vector<T> >(new std::vector<T>(_buffer->begin(), _buffer->begin() + newSize));
+			}
+			else{
+				write().resize(newSize);
+			}
+		}
+	}
+	
+	void clear(){
+		if(_buffer && _buffer.unique()){
+			_buffer->clear();
+		}
+		else{
+			_buffer.reset();
+		}
+	}
+	
+	//! Exchanges the content with values, no copy is made. A shared buffer is left to its other owners, values is then emptied.
+	void swap(std::vector<T> &values){
+		if(!_buffer || !_buffer.unique()){
+			_buffer = boost::shared_ptr<std::vector<T> >(new std::vector<T>());
+		}
+		
+		_buffer->swap(values);
+	}
+	
+	bool isShared() const{
+		return _buffer && !_buffer.unique();
+	}
+
+private:
+	boost::shared_ptr<std::vector<T> > _buffer;
+};
+
+}
+
+#endif
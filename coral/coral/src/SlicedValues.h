@@ -0,0 +1,655 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+
+#ifndef CORAL_SLICEDVALUES_H
+#define CORAL_SLICEDVALUES_H
+
+#include <vector>
+#include <algorithm>
+#include <boost/shared_ptr.hpp>
+#include "coralDefinitions.h"
+#include "SharedVector.h"
+#include "MappedFile.h"
+
+#ifdef CORAL_PARALLEL_TBB
+	#include <tbb/mutex.h>
+#endif
+
+namespace coral{
+
+//! A read only view on the values of one slice of a SlicedValues.
+//
+//! It can be indexed and iterated like a std::vector, toVector() makes a copy of the values when one is needed.
+//! The view is valid until the slice it points to is written.
+template<class T>
+class SliceView{
+public:
+	typedef const T *const_iterator;
+	
+	SliceView(): _data(0), _size(0){
+	}
+	
+	SliceView(const T *data, unsigned int size): _data(data), _size(size){
+	}
+	
+	unsigned int size() const{
+		return _size;
+	}
+	
+	bool empty() const{
+		return _size == 0;
+	}
+	
+	const T &operator[](unsigned int id) const{
+		return _data[id];
+	}
+	
+	const T &back() const{
+		return _data[_size - 1];
+	}
+	
+	const_iterator begin() const{
+		return _data;
+	}
+	
+	const_iterator end() const{
+		return _data + _size;
+	}
+	
+	std::vector<T> toVector() const{
+		return std::vector<T>(_data, _data + _size);
+	}
+
+private:
+	const T *_data;
+	unsigned int _size;
+};
+
+template<class T>
+class SlicedValues;
+
+//! Writes one slice of a SlicedValues in place through the same resize() and operator[] a std::vector would offer.
+template<class T>
+class SliceWriter{
+public:
+	typedef T *iterator;
+	
+	SliceWriter(SlicedValues<T> &values, unsigned int slice): _values(values), _slice(slice), _data(0), _size(0){
+		_data = _values.sliceData(_slice, _size);
+	}
+	
+	//! Resizes the slice first, a shared buffer being shrunk only gets the values kept copied.
+	SliceWriter(SlicedValues<T> &values, unsigned int slice, unsigned int size): _values(values), _slice(slice), _data(0), _size(0){
+		_values.resizeSlice(_slice, size);
+		_data = _values.sliceData(_slice, _size);
+	}
+	
+	unsigned int size() const{
+		return _size;
+	}
+	
+	void resize(unsigned int newSize){
+		_values.resizeSlice(_slice, newSize);
+		_data = _values.sliceData(_slice, _size);
+	}
+	
+	T &operator[](unsigned int id){
+		return _data[id];
+	}
+	
+	iterator begin(){
+		return _data;
+	}
+	
+	iterator end(){
+		return _data + _size;
+	}
+
+private:
+	SlicedValues<T> &_values;
+	unsigned int _slice;
+	T *_data;
+	unsigned int _size;
+};
+
+//! The compact form of a slice repeating one value, or holding an arithmetic sequence, see SlicedValues::setUniformSlice().
+template<class T>
+struct ImplicitSlice{
+	T first;
+	T step;
+	unsigned int size;
+	bool isRange;
+};
+
+// value at id of an implicit range, only int and float slices are ever set as a range.
+template<class T>
+inline T slicedValues_rangeValue(const T &first, const T &step, unsigned int id){
+	return first;
+}
+
+inline int slicedValues_rangeValue(const int &first, const int &step, unsigned int id){
+	return first + step * int(id);
+}
+
+inline float slicedValues_rangeValue(const float &first, const float &step, unsigned int id){
+	return first + step * float(id);
+}
+
+#ifdef CORAL_PARALLEL_TBB
+//! Serializes the expansion of implicit slices read from different threads at the same time.
+CORAL_EXPORT tbb::mutex &slicedValues_expansionMutex();
+#endif
+
+//! The values of all the slices of one type of a Numeric.
+//
+//! Slices holding a single value, as most slices computed inside a loop do, are stored inline in one contiguous buffer, 
+//! the value of slice n sitting at index n. A slice holding more values gets its own SharedVector.
+//! A slice never moves the others when it changes size, so different slices can be written concurrently, 
+//! as long as prepareWrite() was called first. 
+//! Shrinking keeps the capacity of the buffers, they are reused by the next frames.
+//! Both the inline buffer and the buffers of the slices are shared between copies until written, see SharedVector.
+//!
+//! A slice can also be implicit: one value repeated or an arithmetic range, stored as an ImplicitSlice. 
+//! Its values are expanded in the buffer of the slice the first time they are read through slice(), 
+//! kernels aware of the implicit forms can use isImplicit() and implicitSlice() to skip the expansion.
+//!
+//! A slice can also be mapped from a file, see setMappedSlice(), its values are then read from disk one page at a time.
+//! Once a mapped storage is set, slices growing past mappedStorageMinBytes are written to scratch files instead of memory.
+template<class T>
+class SlicedValues{
+public:
+	static const std::size_t mappedStorageMinBytes = 64 * 1024 * 1024;
+	
+	unsigned int slices() const{
+		return _layout.size();
+	}
+	
+	//! Slices added get size values each, slices removed are dropped.
+	void resizeSlices(unsigned int slices, unsigned int size){
+		unsigned int oldSlices = _layout.size();
+		if(slices != oldSlices){
+			if(_mapped.size() > slices){
+				_mapped.resize(slices);
+			}
+			
+			_layout.resize(slices, layoutEmpty);
+			_overflow.resize(slices);
+			_flat.resize(slices);
+			
+			for(unsigned int i = oldSlices; i < slices; ++i){
+				resizeSlice(i, size);
+			}
+		}
+	}
+	
+	//! Makes the buffers of this object its own, call it before writing different slices from different threads.
+	void prepareWrite(){
+		if(_flat.isShared()){
+			_flat.write();
+		}
+	}
+	
+	//! Allocates the descriptors of implicit and mapped slices for every slice, 
+	//! call it before setting different slices as implicit or mapped from different threads.
+	void prepareSliceForms(){
+		if(_implicit.size() < _layout.size()){
+			_implicit.resize(_layout.size());
+		}
+		
+		if(_mapped.size() < _layout.size()){
+			_mapped.resize(_layout.size());
+		}
+	}
+	
+	unsigned int sizeSlice(unsigned int slice) const{
+		unsigned char layout = _layout[slice];
+		if(layout == layoutOverflow){
+			return _overflow[slice].size();
+		}
+		else if(layout == layoutImplicit){
+			return _implicit[slice].size;
+		}
+		else if(layout == layoutMapped){
+			return _mapped[slice]->size() / sizeof(T);
+		}
+		
+		return layout;
+	}
+	
+	//! The values of slice, an implicit slice gets expanded first.
+	SliceView<T> slice(unsigned int slice) const{
+		unsigned char layout = _layout[slice];
+		if(layout == layoutImplicit){
+			#ifdef CORAL_PARALLEL_TBB
+			tbb::mutex::scoped_lock lock(slicedValues_expansionMutex());
+			#endif
+			
+			expandSlice(slice);
+		}
+		
+		if(layout == layoutOverflow || layout == layoutImplicit){
+			const std::vector<T> &values = _overflow[slice].read();
+			if(values.size()){
+				return SliceView<T>(&values[0], values.size());
+			}
+			
+			return SliceView<T>();
+		}
+		else if(layout == layoutMapped){
+			return SliceView<T>((const T*)_mapped[slice]->data(), sizeSlice(slice));
+		}
+		
+		return SliceView<T>(&_flat.read()[slice], layout);
+	}
+	
+	bool isMapped(unsigned int slice) const{
+		return _layout[slice] == layoutMapped;
+	}
+	
+	//! Reads the values of slice from file, a raw array of T. The file is shared by copies and it's written in place only if it's a scratch file, 
+	//! writing a slice mapped from any other file first copies its values, to a scratch file if the values are big enough, see setMappedStorage().
+	void setMappedSlice(unsigned int slice, const boost::shared_ptr<MappedFile> &file){
+		unsigned int size = file->size() / sizeof(T);
+		if(size < 2){
+			const T *data = (const T*)file->data();
+			setSlice(slice, std::vector<T>(data, data + size));
+			return;
+		}
+		
+		releaseMapped(slice);
+		
+		if(_mapped.size() < _layout.size()){
+			_mapped.resize(_layout.size());
+		}
+		
+		_mapped[slice] = file;
+		_overflow[slice] = SharedVector<T>();
+		_layout[slice] = layoutMapped;
+	}
+	
+	//! Slices growing past mappedStorageMinBytes get stored in scratch files created in directory, 
+	//! values too big for memory are then paged to disk by the system. An empty directory keeps all the values in memory.
+	void setMappedStorage(const std::string &directory){
+		_mappedStorage = directory;
+	}
+	
+	const std::string &mappedStorage() const{
+		return _mappedStorage;
+	}
+	
+	bool isImplicit(unsigned int slice) const{
+		return _layout[slice] == layoutImplicit;
+	}
+	
+	//! Only valid for implicit slices, see isImplicit().
+	const ImplicitSlice<T> &implicitSlice(unsigned int slice) const{
+		return _implicit[slice];
+	}
+	
+	//! The value at id of an implicit slice without expanding it, id past the end returns the last value.
+	T implicitValueAt(unsigned int slice, unsigned int id) const{
+		const ImplicitSlice<T> &implicit = _implicit[slice];
+		if(id >= implicit.size){
+			id = implicit.size - 1;
+		}
+		
+		if(implicit.isRange){
+			return slicedValues_rangeValue(implicit.first, implicit.step, id);
+		}
+		
+		return implicit.first;
+	}
+	
+	//! Sets slice to size copies of value without storing them.
+	void setUniformSlice(unsigned int slice, const T &value, unsigned int size){
+		setImplicitSlice(slice, value, T(), size, false);
+	}
+	
+	//! Sets slice to the sequence first, first + step, first + step * 2... of size values, without storing them.
+	//! Only int and float slices support ranges.
+	void setRangeSlice(unsigned int slice, const T &first, const T &step, unsigned int size){
+		setImplicitSlice(slice, first, step, size, true);
+	}
+	
+	void setValueAt(unsigned int slice, unsigned int id, const T &value){
+		materializeSlice(slice);
+		ownMappedSlice(slice);
+		
+		unsigned char layout = _layout[slice];
+		if(layout == layoutMapped){
+			if(id < sizeSlice(slice)){
+				((T*)_mapped[slice]->data())[id] = value;
+			}
+		}
+		else if(layout == layoutOverflow){
+			SharedVector<T> &values = _overflow[slice];
+			if(id < values.size()){
+				values.write()[id] = value;
+			}
+		}
+		else if(id < layout){
+			_flat.write()[slice] = value;
+		}
+	}
+	
+	void setSlice(unsigned int slice, const std::vector<T> &values){
+		releaseMapped(slice);
+		
+		if(values.size() > 1){
+			_overflow[slice].assign(values);
+			_layout[slice] = layoutOverflow;
+		}
+		else{
+			if(values.size()){
+				_flat.write()[slice] = values[0];
+			}
+			
+			_layout[slice] = values.size();
+		}
+	}
+	
+	//! Exchanges the values of slice with values, the caller gets back the previous buffer of the slice to reuse it.
+	//! A single value is copied instead, values is then left untouched.
+	void swapSlice(unsigned int slice, std::vector<T> &values){
+		releaseMapped(slice);
+		
+		if(values.size() > 1){
+			_overflow[slice].swap(values);
+			_layout[slice] = layoutOverflow;
+		}
+		else{
+			setSlice(slice, values);
+		}
+	}
+	
+	//! Shares the values of a slice of other, the buffer of a slice holding many values is not copied 
+	//! and an implicit slice stays implicit.
+	void setSlice(unsigned int slice, const SlicedValues<T> &other, unsigned int otherSlice){
+		if(this != &other || slice != otherSlice){
+			releaseMapped(slice);
+		}
+		
+		unsigned char layout = other._layout[otherSlice];
+		if(layout == layoutOverflow){
+			_overflow[slice] = other._overflow[otherSlice];
+		}
+		else if(layout == layoutMapped){
+			if(_mapped.size() < _layout.size()){
+				_mapped.resize(_layout.size());
+			}
+			
+			_mapped[slice] = other._mapped[otherSlice];
+		}
+		else if(layout == layoutImplicit){
+			if(_implicit.size() < _layout.size()){
+				_implicit.resize(_layout.size());
+			}
+			
+			_implicit[slice] = other._implicit[otherSlice];
+			_overflow[slice] = other._overflow[otherSlice];
+		}
+		else if(layout){
+			_flat.write()[slice] = other._flat.read()[otherSlice];
+		}
+		
+		_layout[slice] = layout;
+	}
+	
+	void resizeSlice(unsigned int slice, unsigned int newSize){
+		materializeSlice(slice);
+		
+		unsigned char layout = _layout[slice];
+		if(layout == layoutMapped){
+			if(newSize == sizeSlice(slice)){
+				return;
+			}
+			
+			// a scratch file owned by this object is resized in place, unless the values now fit in memory
+			boost::shared_ptr<MappedFile> &file = _mapped[slice];
+			std::size_t bytes = std::size_t(newSize) * sizeof(T);
+			if(bytes >= mappedStorageMinBytes && file->isWritable() && file.unique()){
+				if(file->resize(bytes)){
+					return;
+				}
+				
+				// the scratch file could not grow, its values are lost
+				file.reset();
+				_layout[slice] = layoutEmpty;
+				layout = layoutEmpty;
+			}
+			else if(moveToStorage(slice, newSize)){
+				return;
+			}
+			else{
+				unmapSlice(slice, newSize);
+				return;
+			}
+		}
+		else if(moveToStorage(slice, newSize)){
+			return;
+		}
+		
+		if(newSize > 1){
+			SharedVector<T> &values = _overflow[slice];
+			if(layout != layoutOverflow){
+				// a buffer left from a previous frame is reused
+				values.clear();
+				std::vector<T> &buffer = values.write();
+				buffer.resize(newSize);
+				if(layout == layoutSingle){
+					buffer[0] = _flat.read()[slice];
+				}
+				
+				_layout[slice] = layoutOverflow;
+			}
+			else{
+				values.resize(newSize);
+			}
+		}
+		else if(layout == layoutOverflow){
+			const std::vector<T> &values = _overflow[slice].read();
+			if(newSize && values.size()){
+				_flat.write()[slice] = values[0];
+			}
+			else if(newSize){
+				_flat.write()[slice] = T();
+			}
+			
+			_layout[slice] = newSize;
+		}
+		else if(newSize != layout){
+			if(newSize){
+				_flat.write()[slice] = T();
+			}
+			
+			_layout[slice] = newSize;
+		}
+	}
+	
+	//! The values of a slice to be written in place, 0 if the slice is empty.
+	T *sliceData(unsigned int slice, unsigned int &size){
+		materializeSlice(slice);
+		ownMappedSlice(slice);
+		
+		unsigned char layout = _layout[slice];
+		if(layout == layoutMapped){
+			size = sizeSlice(slice);
+			return (T*)_mapped[slice]->data();
+		}
+		else if(layout == layoutOverflow){
+			std::vector<T> &values = _overflow[slice].write();
+			size = values.size();
+			if(size){
+				return &values[0];
+			}
+			
+			return 0;
+		}
+		
+		size = layout;
+		if(layout){
+			return &_flat.write()[slice];
+		}
+		
+		return 0;
+	}
+	
+	//! Mapped slices are not counted, their pages belong to the system.
+	std::size_t sizeInBytes() const{
+		std::size_t size = _flat.capacity() * sizeof(T) + _layout.capacity() + _overflow.capacity() * sizeof(SharedVector<T>);
+		size += _implicit.capacity() * sizeof(ImplicitSlice<T>);
+		for(int i = 0; i < _overflow.size(); ++i){
+			size += _overflow[i].capacity() * sizeof(T);
+		}
+		
+		return size;
+	}
+
+private:
+	enum Layout{
+		layoutEmpty = 0,
+		layoutSingle = 1,
+		layoutOverflow = 2,
+		layoutImplicit = 3,
+		layoutMapped = 4
+	};
+	
+	void releaseMapped(unsigned int slice){
+		if(_layout[slice] == layoutMapped){
+			_mapped[slice].reset();
+			_layout[slice] = layoutEmpty;
+		}
+	}
+	
+	// moves the values of a slice growing past mappedStorageMinBytes to a scratch file, the values past newSize are dropped.
+	bool moveToStorage(unsigned int slice, unsigned int newSize){
+		std::size_t bytes = std::size_t(newSize) * sizeof(T);
+		if(_mappedStorage.empty() || bytes < mappedStorageMinBytes){
+			return false;
+		}
+		
+		boost::shared_ptr<MappedFile> scratch(new MappedFile(_mappedStorage, MappedFile::modeScratch, bytes));
+		if(!scratch->isValid()){
+			return false;
+		}
+		
+		SliceView<T> values = this->slice(slice);
+		unsigned int keepSize = std::min(values.size(), newSize);
+		std::copy(values.begin(), values.begin() + keepSize, (T*)scratch->data());
+		
+		if(_mapped.size() < _layout.size()){
+			_mapped.resize(_layout.size());
+		}
+		
+		_mapped[slice] = scratch;
+		_overflow[slice] = SharedVector<T>();
+		_layout[slice] = layoutMapped;
+		
+		return true;
+	}
+	
+	// copies the values of a mapped slice to memory and releases the file.
+	void unmapSlice(unsigned int slice, unsigned int newSize){
+		SliceView<T> values = this->slice(slice);
+		unsigned int keepSize = std::min(values.size(), newSize);
+		
+		std::vector<T> buffer(newSize);
+		std::copy(values.begin(), values.begin() + keepSize, buffer.begin());
+		swapSlice(slice, buffer);
+	}
+	
+	// a mapped slice is written in place only if it's a scratch file owned by this object, 
+	// otherwise its values get copied to a scratch file of their own or to memory.
+	void ownMappedSlice(unsigned int slice){
+		if(_layout[slice] == layoutMapped){
+			boost::shared_ptr<MappedFile> &file = _mapped[slice];
+			if(!file->isWritable() || !file.unique()){
+				unsigned int size = sizeSlice(slice);
+				if(!moveToStorage(slice, size)){
+					unmapSlice(slice, size);
+				}
+			}
+		}
+	}
+	
+	void setImplicitSlice(unsigned int slice, const T &first, const T &step, unsigned int size, bool isRange){
+		if(size < 2){
+			std::vector<T> values(size, first);
+			setSlice(slice, values);
+			return;
+		}
+		
+		releaseMapped(slice);
+		
+		if(_implicit.size() < _layout.size()){
+			_implicit.resize(_layout.size());
+		}
+		
+		ImplicitSlice<T> &implicit = _implicit[slice];
+		implicit.first = first;
+		implicit.step = step;
+		implicit.size = size;
+		implicit.isRange = isRange;
+		
+		// the buffer of the slice now caches the expanded values, it's filled by the first read.
+		_overflow[slice].clear();
+		_layout[slice] = layoutImplicit;
+	}
+	
+	void expandSlice(unsigned int slice) const{
+		const ImplicitSlice<T> &implicit = _implicit[slice];
+		SharedVector<T> &values = _overflow[slice];
+		if(values.size() != implicit.size){
+			std::vector<T> &buffer = values.write();
+			buffer.resize(implicit.size);
+			for(unsigned int i = 0; i < implicit.size; ++i){
+				buffer[i] = implicit.isRange ? slicedValues_rangeValue(implicit.first, implicit.step, i) : implicit.first;
+			}
+		}
+	}
+	
+	// writing an implicit slice turns it into a regular one.
+	void materializeSlice(unsigned int slice){
+		if(_layout[slice] == layoutImplicit){
+			expandSlice(slice);
+			_layout[slice] = layoutOverflow;
+		}
+	}
+	
+	SharedVector<T> _flat;
+	std::vector<unsigned char> _layout;
+	mutable std::vector<SharedVector<T> > _overflow;
+	std::vector<ImplicitSlice<T> > _implicit;
+	std::vector<boost::shared_ptr<MappedFile> > _mapped;
+	std::string _mappedStorage;
+};
+
+}
+
+#endif
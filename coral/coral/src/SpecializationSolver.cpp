@@ -0,0 +1,278 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+#include <deque>
+#include <algorithm>
+
+#include "SpecializationSolver.h"
+#include "Attribute.h"
+#include "Node.h"
+
+using namespace coral;
+
+std::vector<std::string> SpecializationSolver::_names;
+std::map<std::string, int> SpecializationSolver::_ids;
+
+namespace coral{
+	struct SpecializationBranch{
+		std::vector<Attribute*> attributes;
+		std::vector<std::vector<int> > specializations;
+		std::map<Attribute*, int> indices;
+	};
+}
+
+namespace {
+	// a connection or a specialization link between two attributes of the branch
+	struct SpecializationConstraint{
+		SpecializationConstraint(int a, int b, bool link): attributeA(a), attributeB(b), isLink(link){
+		}
+		
+		int attributeA;
+		int attributeB;
+		bool isLink;
+	};
+	
+	void intersect(const std::vector<int> &specializationA, const std::vector<int> &specializationB, std::vector<int> &result){
+		result.clear();
+		for(int i = 0; i < specializationA.size(); ++i){
+			if(std::find(specializationB.begin(), specializationB.end(), specializationA[i]) != specializationB.end()){
+				result.push_back(specializationA[i]);
+			}
+		}
+	}
+	
+	bool lessId(Attribute *attributeA, Attribute *attributeB){
+		return attributeA->id() < attributeB->id();
+	}
+}
+
+int SpecializationSolver::intern(const std::string &specialization){
+	std::map<std::string, int>::iterator it = _ids.find(specialization);
+	if(it != _ids.end()){
+		return it->second;
+	}
+	
+	int id = _names.size();
+	_names.push_back(specialization);
+	_ids[specialization] = id;
+	
+	return id;
+}
+
+const std::string &SpecializationSolver::name(int id){
+	return _names[id];
+}
+
+void SpecializationSolver::intern(const std::vector<std::string> &specialization, std::vector<int> &ids){
+	ids.resize(specialization.size());
+	for(int i = 0; i < specialization.size(); ++i){
+		ids[i] = intern(specialization[i]);
+	}
+}
+
+void SpecializationSolver::names(const std::vector<int> &ids, std::vector<std::string> &specialization){
+	specialization.resize(ids.size());
+	for(int i = 0; i < ids.size(); ++i){
+		specialization[i] = _names[ids[i]];
+	}
+}
+
+int SpecializationSolver::addToBranch(Attribute *attribute, bool reset, SpecializationBranch &branch){
+	std::map<Attribute*, int>::iterator it = branch.indices.find(attribute);
+	if(it != branch.indices.end()){
+		return it->second;
+	}
+	
+	int index = branch.attributes.size();
+	branch.indices[attribute] = index;
+	branch.attributes.push_back(attribute);
+	branch.specializations.push_back(std::vector<int>());
+	
+	const std::vector<std::string> *specialization = &attribute->_specialization;
+	if(reset){
+		if(attribute->_specializationOverride.size() == 1){
+			specialization = &attribute->_specializationOverride;
+		}
+		else{
+			specialization = &attribute->_allowedSpecialization;
+		}
+	}
+	
+	intern(*specialization, branch.specializations.back());
+	
+	return index;
+}
+
+bool SpecializationSolver::solve(Attribute *attribute, bool reset, std::set<int> *solvedAttributes){
+	// collect the branch, links are solved before connections as they carry the rules of each node
+	SpecializationBranch branch;
+	std::vector<SpecializationConstraint> links;
+	std::vector<SpecializationConstraint> pairs;
+	std::set<SpecializationLink*> visitedLinks;
+	std::set<std::pair<int, int> > visitedPairs;
+	
+	addToBranch(attribute, reset, branch);
+	for(int i = 0; i < branch.attributes.size(); ++i){
+		Attribute *attr = branch.attributes[i];
+		
+		for(int j = 0; j < attr->_specializationLinks.size(); ++j){
+			SpecializationLink *specializationLink = attr->_specializationLinks[j];
+			if(visitedLinks.insert(specializationLink).second){
+				int a = addToBranch(specializationLink->attributeA, reset, branch);
+				int b = addToBranch(specializationLink->attributeB, reset, branch);
+				links.push_back(SpecializationConstraint(a, b, true));
+			}
+		}
+		
+		if(attr->_input){
+			int a = addToBranch(attr->_input, reset, branch);
+			if(visitedPairs.insert(std::make_pair(a, i)).second){
+				pairs.push_back(SpecializationConstraint(a, i, false));
+			}
+		}
+		
+		for(int j = 0; j < attr->_outputs.size(); ++j){
+			int b = addToBranch(attr->_outputs[j], reset, branch);
+			if(visitedPairs.insert(std::make_pair(i, b)).second){
+				pairs.push_back(SpecializationConstraint(i, b, false));
+			}
+		}
+	}
+	
+	std::vector<SpecializationConstraint> constraints = links;
+	constraints.insert(constraints.end(), pairs.begin(), pairs.end());
+	
+	int branchSize = branch.attributes.size();
+	std::vector<std::vector<int> > constraintsByAttribute(branchSize);
+	for(int i = 0; i < constraints.size(); ++i){
+		constraintsByAttribute[constraints[i].attributeA].push_back(i);
+		constraintsByAttribute[constraints[i].attributeB].push_back(i);
+	}
+	
+	// solve
+	std::deque<int> worklist;
+	std::vector<bool> queued(constraints.size(), true);
+	for(int i = 0; i < constraints.size(); ++i){
+		worklist.push_back(i);
+	}
+	
+	bool success = true;
+	int maxSteps = 100 * (constraints.size() + 1);
+	int steps = 0;
+	
+	std::vector<std::string> namesA;
+	std::vector<std::string> namesB;
+	std::vector<int> oldSpecA;
+	std::vector<int> oldSpecB;
+	std::vector<int> newSpec;
+	
+	while(worklist.empty() == false){
+		if(++steps > maxSteps){
+			std::cout << "Maximum recursion reached during specialization." << std::endl;
+			success = false;
+			break;
+		}
+		
+		int constraintId = worklist.front();
+		worklist.pop_front();
+		queued[constraintId] = false;
+		
+		const SpecializationConstraint &constraint = constraints[constraintId];
+		Attribute *attrA = branch.attributes[constraint.attributeA];
+		Attribute *attrB = branch.attributes[constraint.attributeB];
+		std::vector<int> &specA = branch.specializations[constraint.attributeA];
+		std::vector<int> &specB = branch.specializations[constraint.attributeB];
+		
+		oldSpecA = specA;
+		oldSpecB = specB;
+		
+		if(constraint.isLink){
+			if(specA.size() > 1 || specB.size() > 1){
+				Node *parentNode = attrA->parent();
+				if(parentNode){
+					names(specA, namesA);
+					names(specB, namesB);
+					
+					parentNode->updateSpecializationLink(attrA, attrB, namesA, namesB);
+					
+					intern(namesA, specA);
+					intern(namesB, specB);
+				}
+			}
+		}
+		else{
+			if(attrA->_passThrough && specA.size() == 0){
+				specA = specB;
+			}
+			else if(attrB->_passThrough && specB.size() == 0){
+				specB = specA;
+			}
+			else if(specA != specB){
+				intersect(specA, specB, newSpec);
+				
+				specA = newSpec;
+				specB = newSpec;
+			}
+		}
+		
+		// only the constraints touching a changed attribute need to be solved again
+		for(int side = 0; side < 2; ++side){
+			int changedAttribute = side == 0 ? constraint.attributeA : constraint.attributeB;
+			bool changed = side == 0 ? specA != oldSpecA : specB != oldSpecB;
+			
+			if(changed){
+				const std::vector<int> &neighbours = constraintsByAttribute[changedAttribute];
+				for(int i = 0; i < neighbours.size(); ++i){
+					int neighbour = neighbours[i];
+					if(neighbour != constraintId && queued[neighbour] == false){
+						queued[neighbour] = true;
+						worklist.push_back(neighbour);
+					}
+				}
+			}
+		}
+	}
+	
+	// set the resulting specializations, in creation order of the attributes
+	std::vector<Attribute*> sortedAttributes = branch.attributes;
+	std::sort(sortedAttributes.begin(), sortedAttributes.end(), lessId);
+	
+	std::vector<std::string> specialization;
+	for(int i = 0; i < sortedAttributes.size(); ++i){
+		Attribute *attr = sortedAttributes[i];
+		
+		names(branch.specializations[branch.indices[attr]], specialization);
+		attr->setSpecialization(specialization);
+		
+		if(solvedAttributes){
+			solvedAttributes->insert(attr->id());
+		}
+	}
+	
+	return success;
+}
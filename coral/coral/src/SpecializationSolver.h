@@ -0,0 +1,71 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+
+#ifndef CORAL_SPECIALIZATIONSOLVER_H
+#define CORAL_SPECIALIZATIONSOLVER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include "coralDefinitions.h"
+
+namespace coral{
+class Attribute;
+struct SpecializationBranch;
+
+//! Solves the specializations of a branch of attributes tied by connections and specialization links.
+//
+//! Specialization names are interned to small integers, candidates are kept as vectors of ids so that 
+//! comparisons and intersections don't go through strings. Connections and links are solved from a worklist: 
+//! each one is solved again only when the specialization of one of its two attributes changed.
+//! Links are still solved by Node::updateSpecializationLink(), which receives the names.
+class CORAL_EXPORT SpecializationSolver{
+public:
+	//! Returns the id of specialization, registering it the first time it's seen.
+	static int intern(const std::string &specialization);
+	static const std::string &name(int id);
+	
+	//! Solves the branch attribute belongs to and sets the result on each of its attributes.
+	//! If reset is true the attributes start from their override or their allowed specialization, otherwise from their current one.
+	//! The ids of the attributes found in the branch are added to solvedAttributes, when given.
+	static bool solve(Attribute *attribute, bool reset, std::set<int> *solvedAttributes = 0);
+
+private:
+	static std::vector<std::string> _names;
+	static std::map<std::string, int> _ids;
+	
+	static int addToBranch(Attribute *attribute, bool reset, SpecializationBranch &branch);
+	static void intern(const std::vector<std::string> &specialization, std::vector<int> &ids);
+	static void names(const std::vector<int> &ids, std::vector<std::string> &specialization);
+};
+
+}
+
+#endif
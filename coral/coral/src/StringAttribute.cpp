@@ -30,6 +30,23 @@
 
 using namespace coral;
 
+void String::copy(const Value *other)
+{
+	const String *otherString = dynamic_cast<const String*>(other);
+	
+	if(otherString){
+		_value = otherString->_value;
+	}
+}
+
+Value *String::duplicate()
+{
+	String *value = new String();
+	value->copy(this);
+	
+	return value;
+}
+
 void String::setStringValue(std::string value)
 {
 	_value = value;
@@ -51,6 +68,17 @@ void String::setFromString(const std::string &value)
 	_value = value;
 }
 
+bool String::contentHash(std::size_t &hash)
+{
+	hash = hashBytes(_value.data(), _value.size(), 0);
+	return true;
+}
+
+std::size_t String::sizeInBytes()
+{
+	return _value.capacity();
+}
+
 StringAttribute::StringAttribute(const std::string &name, Node *parent)
 	: Attribute(name, parent)
 	, _longString(false)
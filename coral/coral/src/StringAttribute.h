@@ -39,6 +39,10 @@ namespace coral{
 	//! Wraps an std::string, used by StringAttribute.
 	class CORAL_EXPORT String : public Value{
 	public:
+		void copy(const Value *other);
+		
+		Value *duplicate();
+		
 		void setStringValue(std::string value);
 
 		const std::string &stringValue();
@@ -46,6 +50,9 @@ namespace coral{
 		std::string asString();
 	
 		void setFromString(const std::string &value);
+		
+		bool contentHash(std::size_t &hash);
+		std::size_t sizeInBytes();
 
 	private:
 		std::string _value;
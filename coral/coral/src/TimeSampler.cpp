@@ -0,0 +1,451 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+#ifdef CORAL_PARALLEL_TBB
+	#include <tbb/parallel_for.h>
+	#include <tbb/blocked_range.h>
+	#include <tbb/enumerable_thread_specific.h>
+	#include <tbb/atomic.h>
+#endif
+
+#include <algorithm>
+
+#include "TimeSampler.h"
+#include "Attribute.h"
+#include "NumericAttribute.h"
+#include "Numeric.h"
+#include "Node.h"
+#include "NetworkManager.h"
+#include "EvaluationPlan.h"
+#include "EvaluationContext.h"
+#include "coreParallelAlgos.h"
+
+using namespace coral;
+
+#ifdef CORAL_PARALLEL_TBB
+namespace {
+	// samples being evaluated by TimeSampler::evaluate(), Attribute::value() only looks up the copies while this is non zero
+	tbb::atomic<int> _samplesInFlight;
+	tbb::enumerable_thread_specific<TimeSample*> _threadSample((TimeSample*)0);
+}
+#endif
+
+TimeSampler::TimeSampler(NumericAttribute *time):
+	_timeId(time->id()),
+	_currentSample(-1),
+	_originalTime(0.0),
+	_timeChanged(false),
+	_firstSampleReady(false),
+	_graphRevision(0){
+}
+
+TimeSampler::~TimeSampler(){
+	clearSamples();
+}
+
+void TimeSampler::setSamples(const std::vector<float> &samples){
+	reset();
+	
+	_samples = samples;
+}
+
+const std::vector<float> &TimeSampler::samples(){
+	return _samples;
+}
+
+void TimeSampler::addOutput(Attribute *output){
+	_outputIds.push_back(output->id());
+}
+
+int TimeSampler::currentSample(){
+	return _currentSample;
+}
+
+std::vector<Attribute*> TimeSampler::outputs(){
+	std::vector<Attribute*> outputs;
+	for(int i = 0; i < _outputIds.size(); ++i){
+		Attribute *output = (Attribute*)NetworkManager::findObjectById(_outputIds[i]);
+		if(output){
+			outputs.push_back(output);
+		}
+	}
+	
+	return outputs;
+}
+
+void TimeSampler::setTime(NumericAttribute *time, float value){
+	if(!_timeChanged){
+		_originalTime = time->outValue()->floatValueAt(0);
+		_timeChanged = true;
+	}
+	
+	time->outValue()->setFloatValueAt(0, value);
+	time->valueChanged();
+}
+
+bool TimeSampler::next(){
+	NumericAttribute *time = (NumericAttribute*)NetworkManager::findObjectById(_timeId);
+	if(!time){
+		return false;
+	}
+	
+	if(_currentSample + 1 >= (int)_samples.size()){
+		reset();
+		return false;
+	}
+	
+	_currentSample++;
+	
+	if(_currentSample == 0 && _firstSampleReady){
+		// already cleaned by evaluate(), the network is still set to this sample
+		return true;
+	}
+	
+	if(_currentSample < _sampleValues.size() && !_sampleValues[_currentSample].values.empty()){
+		if(_graphRevision == NetworkManager::graphRevision()){
+			publishSample(time, _currentSample);
+			return true;
+		}
+		
+		// the network was edited since evaluate(), the copies might not match it anymore
+		clearSamples();
+	}
+	
+	setTime(time, _samples[_currentSample]);
+	
+	Attribute::clean(outputs());
+	
+	return true;
+}
+
+void TimeSampler::reset(){
+	if(_timeChanged){
+		NumericAttribute *time = (NumericAttribute*)NetworkManager::findObjectById(_timeId);
+		if(time){
+			time->outValue()->setFloatValueAt(0, _originalTime);
+			time->valueChanged();
+		}
+		
+		_timeChanged = false;
+	}
+	
+	_currentSample = -1;
+	_firstSampleReady = false;
+	
+	clearSamples();
+}
+
+void TimeSampler::clearSamples(){
+	for(int i = 0; i < _sampleValues.size(); ++i){
+		std::map<Value*, Value*> &values = _sampleValues[i].values;
+		for(std::map<Value*, Value*>::iterator it = values.begin(); it != values.end(); ++it){
+			delete it->second;
+		}
+	}
+	
+	_sampleValues.clear();
+	_steps.clear();
+	_sampledAttributes.clear();
+	_passiveAttributes.clear();
+}
+
+bool TimeSampler::evaluate(){
+	reset();
+	
+	// the first sample goes through the regular engine, it also cleans the static part of the network shared by all the samples
+	if(!next()){
+		return false;
+	}
+	
+	_currentSample = -1;
+	_firstSampleReady = true;
+	
+	#ifdef CORAL_PARALLEL_TBB
+		if(_samples.size() < 2 || NetworkManager::isBatchEditing()){
+			return false;
+		}
+		
+		NumericAttribute *time = (NumericAttribute*)NetworkManager::findObjectById(_timeId);
+		if(!collectSteps(time)){
+			clearSamples();
+			return false;
+		}
+		
+		std::set<EvaluationContext*> contexts;
+		contexts.insert(time->evaluationContext());
+		for(int i = 0; i < _steps.size(); ++i){
+			contexts.insert(_steps[i].outputs[0]->evaluationContext());
+		}
+		
+		for(std::set<EvaluationContext*>::iterator it = contexts.begin(); it != contexts.end(); ++it){
+			if((*it)->isEvaluating()){
+				// called by a node being updated
+				clearSamples();
+				return false;
+			}
+		}
+		
+		_sampleValues.resize(_samples.size());
+		for(int i = 1; i < _samples.size(); ++i){
+			std::map<Value*, Value*> &values = _sampleValues[i].values;
+			
+			Numeric *timeValue = (Numeric*)time->_value->duplicate();
+			timeValue->setFloatValueAt(0, _samples[i]);
+			values[time->_value] = timeValue;
+			
+			for(int j = 0; j < _sampledAttributes.size(); ++j){
+				Value *value = _sampledAttributes[j]->_value;
+				Value *copy = value->duplicate();
+				if(!copy){
+					clearSamples();
+					return false;
+				}
+				
+				values[value] = copy;
+			}
+		}
+		
+		// static attributes stay clean, their value is read as it is by all the samples
+		for(std::set<EvaluationContext*>::iterator it = contexts.begin(); it != contexts.end(); ++it){
+			(*it)->setIsEvaluating(true);
+		}
+		
+		_samplesInFlight++;
+		tbb::parallel_for(tbb::blocked_range<size_t>(1, _samples.size()), timeSampler_parallelEvaluate(this));
+		_samplesInFlight--;
+		
+		for(std::set<EvaluationContext*>::iterator it = contexts.begin(); it != contexts.end(); ++it){
+			(*it)->setIsEvaluating(false);
+		}
+		
+		_graphRevision = NetworkManager::graphRevision();
+		
+		return true;
+	#else
+		return false;
+	#endif
+}
+
+bool TimeSampler::collectSteps(NumericAttribute *time){
+	if(!time || !time->_value){
+		return false;
+	}
+	
+	// the part of the upstream depending on time, static attributes are left out
+	unsigned int visitStamp = Attribute::newVisitStamp();
+	
+	std::vector<Attribute*> upstream;
+	std::vector<Attribute*> targets = outputs();
+	for(int i = 0; i < targets.size(); ++i){
+		Attribute *target = targets[i];
+		if(target->_visitStamp != visitStamp && target->isAnimated()){
+			target->_visitStamp = visitStamp;
+			upstream.push_back(target);
+		}
+	}
+	
+	for(int i = 0; i < upstream.size(); ++i){
+		Attribute *attr = upstream[i];
+		if(!attr->_evaluationPlan || attr->isClean() == false){
+			return false;
+		}
+		
+		Attribute *input = attr->_input;
+		if(input && input->_visitStamp != visitStamp && input->isAnimated()){
+			input->_visitStamp = visitStamp;
+			upstream.push_back(input);
+		}
+		
+		for(int j = 0; j < attr->_affectedBy.size(); ++j){
+			Attribute *affectedBy = attr->_affectedBy[j];
+			if(affectedBy->_visitStamp != visitStamp && affectedBy->isAnimated()){
+				if(affectedBy->_isLazy){
+					// only evaluated if read, the samples can't tell in advance
+					return false;
+				}
+				
+				affectedBy->_visitStamp = visitStamp;
+				upstream.push_back(affectedBy);
+			}
+		}
+	}
+	
+	// laid out in evaluation order like CompiledNetwork::compile(), plans don't depend on each other
+	std::vector<EvaluationPlan*> plans;
+	std::map<EvaluationPlan*, std::vector<std::pair<int, Attribute*> > > attributesByPlan;
+	for(int i = 0; i < upstream.size(); ++i){
+		Attribute *attr = upstream[i];
+		EvaluationPlan *plan = attr->_evaluationPlan.get();
+		std::vector<std::pair<int, Attribute*> > &planAttributes = attributesByPlan[plan];
+		if(planAttributes.empty()){
+			plans.push_back(plan);
+		}
+		
+		planAttributes.push_back(std::make_pair(attr->_planIndex, attr));
+	}
+	
+	for(int i = 0; i < plans.size(); ++i){
+		EvaluationPlan *plan = plans[i];
+		std::vector<std::pair<int, Attribute*> > &planAttributes = attributesByPlan[plan];
+		std::sort(planAttributes.begin(), planAttributes.end());
+		
+		std::vector<Attribute*> tasks;
+		for(int j = 0; j < planAttributes.size(); ++j){
+			Attribute *attr = planAttributes[j].second;
+			Node *parentNode = attr->parent();
+			if(attr == time || !EvaluationPlan::isTask(attr) || !parentNode || !parentNode->updateEnabled()){
+				// set by the sampler or carried over from the attribute feeding it
+				_passiveAttributes.push_back(attr);
+			}
+			else{
+				tasks.push_back(attr);
+			}
+		}
+		
+		std::vector<std::vector<Attribute*> > taskGroups;
+		plan->groupTasks(tasks, taskGroups);
+		
+		for(int j = 0; j < taskGroups.size(); ++j){
+			Node *parentNode = taskGroups[j][0]->parent();
+			
+			// updated concurrently like the slices of a node nested in a slicer, see Node::setSliceable()
+			if(!parentNode->_sliceable || parentNode->_slicer || parentNode->_isSlicer || parentNode->_keepsState){
+				return false;
+			}
+			
+			if(parentNode->_updateOutputsTogether){
+				// all the outputs are written by one update, each of them needs its own copy
+				std::vector<Attribute*> nodeOutputs = parentNode->outputAttributes();
+				for(int k = 0; k < nodeOutputs.size(); ++k){
+					if(nodeOutputs[k]->_visitStamp != visitStamp){
+						return false;
+					}
+				}
+			}
+			
+			Step step;
+			step.node = parentNode;
+			step.outputs = taskGroups[j];
+			_steps.push_back(step);
+			
+			for(int k = 0; k < taskGroups[j].size(); ++k){
+				Attribute *output = taskGroups[j][k];
+				if(!output->_value){
+					return false;
+				}
+				
+				_sampledAttributes.push_back(output);
+			}
+		}
+	}
+	
+	return true;
+}
+
+void TimeSampler::evaluateSample(int sample){
+	#ifdef CORAL_PARALLEL_TBB
+		TimeSample *&threadSample = _threadSample.local();
+		TimeSample *previousSample = threadSample;
+		threadSample = &_sampleValues[sample];
+		
+		// inputs read by the nodes return their value as it is, the steps feeding them were already done
+		for(int i = 0; i < _steps.size(); ++i){
+			Step &step = _steps[i];
+			if(step.node->updateOutputsTogether()){
+				step.node->updateOutputs(step.outputs);
+			}
+			else{
+				step.node->update(step.outputs[0]);
+			}
+		}
+		
+		threadSample = previousSample;
+	#endif
+}
+
+void TimeSampler::publishSample(NumericAttribute *time, int sample){
+	TimeSample &timeSample = _sampleValues[sample];
+	
+	setTime(time, _samples[sample]);
+	
+	// same as cleaning the network for this sample, only the values are copied instead of computed
+	unsigned int epoch = Attribute::newEvaluationEpoch();
+	for(int i = 0; i < _sampledAttributes.size(); ++i){
+		Attribute *attr = _sampledAttributes[i];
+		attr->_value->copy(timeSample.values[attr->_value]);
+		attr->_cleanEpoch = epoch;
+		attr->_computedEpoch = epoch;
+		attr->_computeCount++;
+		attr->updateChangedEpoch();
+	}
+	
+	for(int i = 0; i < _passiveAttributes.size(); ++i){
+		_passiveAttributes[i]->_cleanEpoch = epoch;
+	}
+	
+	// left dirty by their node while updated for this sample
+	for(std::set<Attribute*>::iterator it = timeSample.dirtyAttributes.begin(); it != timeSample.dirtyAttributes.end(); ++it){
+		(*it)->setIsClean(false);
+	}
+}
+
+Value *TimeSampler::sampleValue(Value *value){
+	#ifdef CORAL_PARALLEL_TBB
+		if(_samplesInFlight && value){
+			TimeSample *sample = _threadSample.local();
+			if(sample){
+				std::map<Value*, Value*>::iterator it = sample->values.find(value);
+				if(it != sample->values.end()){
+					return it->second;
+				}
+			}
+		}
+	#endif
+	
+	return value;
+}
+
+bool TimeSampler::setSampleAttributeIsClean(Attribute *attribute, bool value){
+	#ifdef CORAL_PARALLEL_TBB
+		if(_samplesInFlight){
+			TimeSample *sample = _threadSample.local();
+			if(sample){
+				if(value){
+					sample->dirtyAttributes.erase(attribute);
+				}
+				else{
+					sample->dirtyAttributes.insert(attribute);
+				}
+				
+				return true;
+			}
+		}
+	#endif
+	
+	return false;
+}
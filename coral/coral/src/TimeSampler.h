@@ -0,0 +1,126 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+#ifndef CORAL_TIMESAMPLER_H
+#define CORAL_TIMESAMPLER_H
+
+#include <vector>
+#include <map>
+#include <set>
+#include "coralDefinitions.h"
+
+namespace coral{
+class Attribute;
+class NumericAttribute;
+class Node;
+class Value;
+class timeSampler_parallelEvaluate;
+
+//! The values computed for one time sample by TimeSampler::evaluate(), copies of the values of the network mapped by the original they stand for.
+struct TimeSample{
+	std::map<Value*, Value*> values;
+	std::set<Attribute*> dirtyAttributes;
+};
+
+//! Evaluates a network for a sequence of time samples, to bake caches or to compute motion blur subframes.
+//
+//! The time attribute, usually the time output of a Time node, is set to each sample in turn and the outputs 
+//! are cleaned together by Attribute::clean(outputs): their common upstream is scheduled once and unconnected networks run concurrently.
+//! Attributes that don't depend on time are computed for the first sample and shared by all the others.
+//!
+//! evaluate() computes the samples following the first one concurrently: the nodes depending on time are updated for each sample 
+//! on its own copy of the values they compute, see Value::duplicate(), while static values are read by all the samples.
+//! next() then makes the values of each sample current in turn, as if the network had just been cleaned for it.
+//! Networks keeping a state from one step to the next, such as the ones using SetSimulationStep and GetSimulationStep, 
+//! see Node::setKeepsState(), are evaluated by next() one sample after the other, in order.
+//! Objects are tracked by id, outputs deleted while sampling are skipped.
+class CORAL_EXPORT TimeSampler{
+public:
+	TimeSampler(NumericAttribute *time);
+	~TimeSampler();
+	
+	void setSamples(const std::vector<float> &samples);
+	const std::vector<float> &samples();
+	void addOutput(Attribute *output);
+	
+	//! Evaluates the first sample and then all the others concurrently, their values are kept until next() reaches them.
+	//! The nodes depending on time must be sliceable and not nested in a slicer, they must not keep a state or read a lazy input 
+	//! and their values must support Value::duplicate(). Returns false otherwise, next() then evaluates the remaining samples itself.
+	//! The values kept are dropped if the graph is edited, see NetworkManager::graphRevision().
+	bool evaluate();
+	
+	//! Sets the time to the next sample and cleans the outputs, or makes current the values evaluate() computed for it, so that they can be read.
+	//! Returns false once all the samples were evaluated, the time is then restored to the value it had before sampling.
+	bool next();
+	
+	//! The index of the sample last evaluated by next(), -1 before the first call.
+	int currentSample();
+	
+	//! Restores the original time if sampling was interrupted and starts again from the first sample, the values kept by evaluate() are dropped.
+	void reset();
+	
+	//! The copy of value made for the sample evaluated by the calling thread, value itself when no sample is being evaluated.
+	//! Attribute::value() and Attribute::outValue() go through it, so that the nodes updated for a sample work on its own values.
+	static Value *sampleValue(Value *value);
+	
+	//! Keeps the clean state a node sets on attribute while being updated for a sample, see Node::setAttributeIsClean().
+	//! Returns false when no sample is being evaluated by the calling thread.
+	static bool setSampleAttributeIsClean(Attribute *attribute, bool value);
+
+private:
+	friend class timeSampler_parallelEvaluate;
+	
+	struct Step{
+		Node *node;
+		std::vector<Attribute*> outputs;
+	};
+	
+	int _timeId;
+	std::vector<int> _outputIds;
+	std::vector<float> _samples;
+	int _currentSample;
+	float _originalTime;
+	bool _timeChanged;
+	bool _firstSampleReady;
+	std::vector<Step> _steps;
+	std::vector<Attribute*> _sampledAttributes;
+	std::vector<Attribute*> _passiveAttributes;
+	std::vector<TimeSample> _sampleValues;
+	unsigned int _graphRevision;
+	
+	std::vector<Attribute*> outputs();
+	void setTime(NumericAttribute *time, float value);
+	bool collectSteps(NumericAttribute *time);
+	void evaluateSample(int sample);
+	void publishSample(NumericAttribute *time, int sample);
+	void clearSamples();
+};
+
+}
+
+#endif
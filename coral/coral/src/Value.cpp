@@ -45,5 +45,29 @@ void Value::setFromString(const std::string &value){
 void Value::copy(const Value *other){
 }
 
+Value *Value::duplicate(){
+	return 0;
+}
+
 void Value::resizeSlices(unsigned int slices){
 }
+
+bool Value::contentHash(std::size_t &hash){
+	return false;
+}
+
+std::size_t Value::sizeInBytes(){
+	return 0;
+}
+
+std::size_t Value::hashBytes(const void *data, std::size_t size, std::size_t seed){
+	// FNV-1a
+	const unsigned char *bytes = (const unsigned char*)data;
+	std::size_t hash = seed ^ 2166136261u;
+	for(std::size_t i = 0; i < size; ++i){
+		hash ^= bytes[i];
+		hash *= 16777619u;
+	}
+	
+	return hash;
+}
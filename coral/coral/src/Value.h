@@ -30,6 +30,7 @@
 #define CORAL_VALUE_H
 
 #include <string>
+#include <cstddef>
 #include "Object.h"
 
 namespace coral{
@@ -41,10 +42,23 @@ public:
 	virtual ~Value();
 	
 	virtual void copy(const Value *other);
+	
+	//! A new value of the same type holding a copy of this one, owned by the caller. 
+	//! Returns 0 if this type of value can't be duplicated, see TimeSampler::evaluate().
+	virtual Value *duplicate();
 	virtual std::string asString();
 	virtual void setFromString(const std::string &value);
 	virtual void resizeSlices(unsigned int slices);
-
+	
+	//! Computes a hash of the content of this value, used by the early cutoff mode to tell if an output changed after its node was updated.
+	//! Returns false if this value can't be hashed, in which case the value is considered changed after every update.
+	virtual bool contentHash(std::size_t &hash);
+	
+	//! The memory held by the data of this value, reported by Attribute::valueBytes().
+	virtual std::size_t sizeInBytes();
+	
+	//! Hashes size bytes starting at data, combined with seed.
+	static std::size_t hashBytes(const void *data, std::size_t size, std::size_t seed);
 };
 
 }
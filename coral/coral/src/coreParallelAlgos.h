@@ -32,34 +32,88 @@
 #ifdef CORAL_PARALLEL_TBB
 
 #include <tbb/blocked_range.h>
+#include <tbb/parallel_do.h>
+#include <tbb/atomic.h>
 #include <vector>
+#include <boost/shared_ptr.hpp>
 #include "Attribute.h"
 #include "Node.h"
+#include "Profiler.h"
+#include "EvaluationContext.h"
+#include "AsyncEvaluation.h"
+#include "TimeSampler.h"
 
 namespace coral{
 	
-class attribute_parallelClean{
+// Body for tbb::parallel_do: cleans one task group of the graph and feeds the successors that have no more pending predecessors,
+// tbb's work stealing will then pick them up as soon as possible instead of waiting for a whole dependency level to be done.
+class attribute_parallelCleanTask{
 public:
-	attribute_parallelClean(std::vector<Attribute*> *cleanChain): _cleanChain(cleanChain){ 
+	attribute_parallelCleanTask(std::vector<CleanTask> *cleanTasks, std::vector<tbb::atomic<int> > *pendingPredecessors): 
+		_cleanTasks(cleanTasks),
+		_pendingPredecessors(pendingPredecessors){ 
+	}
+	
+	void operator() (int task, tbb::parallel_do_feeder<int> &feeder) const{
+		CleanTask &cleanTask = _cleanTasks->at(task);
+		Attribute::cleanTaskGroup(cleanTask.attributes);
+		
+		for(int i = 0; i < cleanTask.successors.size(); ++i){
+			int successor = cleanTask.successors[i];
+			if(--_pendingPredecessors->at(successor) == 0){
+				feeder.add(successor);
+			}
+		}
+	}
+
+private:
+	std::vector<CleanTask> *_cleanTasks;
+	std::vector<tbb::atomic<int> > *_pendingPredecessors;
+};
+
+// Body for tbb::parallel_for: cleans groups of attributes belonging to networks that are not connected to each other.
+class attribute_parallelCleanGroups{
+public:
+	attribute_parallelCleanGroups(std::vector<std::vector<Attribute*> > *groups): _groups(groups){
 	}
 	
 	void operator() (const tbb::blocked_range<size_t> &r) const{
 		for(size_t i = r.begin(); i != r.end(); ++i){
-			_cleanChain->at(i)->cleanSelf();
+			Attribute::cleanGroup(_groups->at(i));
 		}
 	}
 
 private:
-	std::vector<Attribute*> *_cleanChain;
+	std::vector<std::vector<Attribute*> > *_groups;
+};
+
+// Body for tbb::tbb_thread: runs an AsyncEvaluation, the shared pointer keeps it alive until the worker is done.
+class asyncEvaluation_worker{
+public:
+	asyncEvaluation_worker(boost::shared_ptr<AsyncEvaluation> evaluation): _evaluation(evaluation){
+	}
+	
+	void operator() (){
+		_evaluation->run();
+	}
+
+private:
+	boost::shared_ptr<AsyncEvaluation> _evaluation;
 };
 
+// Slices stop being computed once the evaluation is cancelled, see EvaluationContext::isCancelled().
 class node_parallelUpdate{
 public:
-	node_parallelUpdate(Node *node, Attribute* attribute): _node(node), _attribute(attribute){ 
+	node_parallelUpdate(Node *node, Attribute* attribute, EvaluationContext *context): _node(node), _attribute(attribute), _context(context){ 
 	}
 	
 	void operator() (const tbb::blocked_range<size_t> &r) const{
 		for(size_t i = r.begin(); i != r.end(); ++i){
+			if(_context->isCancelled()){
+				return;
+			}
+			
+			ProfilerScope profilerScope(Profiler::spanTypeSlice, _attribute, i);
 			_node->updateSlice(_attribute, i);
 		}
 	}
@@ -67,6 +121,45 @@ public:
 private:
 	Node *_node;
 	Attribute *_attribute;
+	EvaluationContext *_context;
+};
+
+class node_parallelUpdateOutputs{
+public:
+	node_parallelUpdateOutputs(Node *node, const std::vector<Attribute*> *outputs, EvaluationContext *context): _node(node), _outputs(outputs), _context(context){ 
+	}
+	
+	void operator() (const tbb::blocked_range<size_t> &r) const{
+		for(size_t i = r.begin(); i != r.end(); ++i){
+			if(_context->isCancelled()){
+				return;
+			}
+			
+			ProfilerScope profilerScope(Profiler::spanTypeSlice, _outputs->at(0), i);
+			_node->updateOutputsSlice(*_outputs, i);
+		}
+	}
+
+private:
+	Node *_node;
+	const std::vector<Attribute*> *_outputs;
+	EvaluationContext *_context;
+};
+
+// Body for tbb::parallel_for: updates the nodes depending on time for each sample, on the copies of the values held by that sample.
+class timeSampler_parallelEvaluate{
+public:
+	timeSampler_parallelEvaluate(TimeSampler *sampler): _sampler(sampler){
+	}
+	
+	void operator() (const tbb::blocked_range<size_t> &r) const{
+		for(size_t i = r.begin(); i != r.end(); ++i){
+			_sampler->evaluateSample(i);
+		}
+	}
+
+private:
+	TimeSampler *_sampler;
 };
 
 }
@@ -54,9 +54,18 @@ namespace pythonWrapperUtils{
 		}
 	};
 	
+	// raises a python exception for objects created once NetworkManager ran out of ids, see Object::id()
+	inline void checkObjectId(Object *object){
+		if(object->id() == 0){
+			PyErr_SetString(PyExc_MemoryError, "out of object ids, too many objects were created");
+			boost::python::throw_error_already_set();
+		}
+	}
+	
 	template<class WrappedType>
 	boost::python::object _common__init__impl(boost::python::object &self){
 		WrappedType *object = boost::python::extract<WrappedType*>(self);
+		checkObjectId(object);
 		
 		PythonDataCollector::storeBorrowedPyObject(object->id(), self.ptr());
 		
@@ -67,6 +76,7 @@ namespace pythonWrapperUtils{
 	template<class WrappedType>
 	boost::python::object createUnwrapped(){
 		boost::shared_ptr<WrappedType> object(new WrappedType());
+		checkObjectId(object.get());
 
 		boost::python::object pyObject(object);
 		PythonDataCollector::storePyObject(object->id(), boost::python::object(boost::python::handle<>(pyObject.ptr())));
@@ -77,6 +87,7 @@ namespace pythonWrapperUtils{
 	template<class WrappedType, class ArgType1>
 	boost::python::object createUnwrapped1(ArgType1 arg1){
 		boost::shared_ptr<WrappedType> object(new WrappedType(arg1));
+		checkObjectId(object.get());
 		
 		boost::python::object pyObject(object);
 		PythonDataCollector::storePyObject(object->id(), boost::python::object(boost::python::handle<>(pyObject.ptr())));
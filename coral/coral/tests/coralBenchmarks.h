@@ -0,0 +1,687 @@
+// <license>
+// Copyright (C) 2011 Andrea Interguglielmi, All rights reserved.
+// This file is part of the coral repository downloaded from http://code.google.com/p/coral-repo.
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// 
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+// 
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+// IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// </license>
+
+#ifndef CORALBENCHMARKS_H
+#define CORALBENCHMARKS_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "../src/Object.h"
+#include "../src/Node.h"
+#include "../src/NodeAccessor.h"
+#include "../src/AttributeAccessor.h"
+#include "../src/NetworkManager.h"
+#include "../src/CompiledNetwork.h"
+#include "../src/NumericAttribute.h"
+#include "../src/StringAttribute.h"
+#include "../src/PassThroughAttribute.h"
+#include "../src/Numeric.h"
+#include "../src/Geo.h"
+#include "../builtinNodes/NumericOperation.h"
+#include "../builtinNodes/ArithmeticNodes.h"
+#include "../builtinNodes/KdNodes.h"
+#include "../builtinNodes/LoopNodes.h"
+#include "../builtinNodes/DeformerNodes.h"
+#include "../builtinNodes/GeoNodes.h"
+#include "../builtinNodes/ObjImporter.h"
+#include "../builtinNodes/CoralIOImporter.h"
+
+using namespace coral;
+
+namespace coralBenchmarks{
+	
+	//! Timing of one workload, written as an entry of the json report.
+	struct Result{
+		std::string name;
+		std::map<std::string, double> parameters;
+		int iterations;
+		double minSeconds;
+		double meanSeconds;
+	};
+	
+	class Timer{
+	public:
+		Timer(): _start(boost::posix_time::microsec_clock::universal_time()){
+		}
+		
+		double seconds(){
+			boost::posix_time::ptime end = boost::posix_time::microsec_clock::universal_time();
+			return boost::posix_time::time_period(_start, end).length().total_microseconds() / 1000000.0;
+		}
+	
+	private:
+		boost::posix_time::ptime _start;
+	};
+	
+	//! Collects the time of each iteration of a workload.
+	class Samples{
+	public:
+		void add(double seconds){
+			_seconds.push_back(seconds);
+		}
+		
+		Result result(const std::string &name, const std::map<std::string, double> &parameters){
+			Result result;
+			result.name = name;
+			result.parameters = parameters;
+			result.iterations = _seconds.size();
+			result.minSeconds = 0.0;
+			result.meanSeconds = 0.0;
+			
+			for(int i = 0; i < _seconds.size(); ++i){
+				if(i == 0 || _seconds[i] < result.minSeconds){
+					result.minSeconds = _seconds[i];
+				}
+				result.meanSeconds += _seconds[i];
+			}
+			
+			if(_seconds.size()){
+				result.meanSeconds /= _seconds.size();
+			}
+			
+			std::cout << "* " << name << ": min " << result.minSeconds << "s, mean " << result.meanSeconds << "s over " << result.iterations << " iterations" << std::endl;
+			
+			return result;
+		}
+	
+	private:
+		std::vector<double> _seconds;
+	};
+	
+	//! Linear congruential generator, every run of the suite works on the same data.
+	class Random{
+	public:
+		Random(unsigned int seed): _state(seed){
+		}
+		
+		float next(){
+			_state = _state * 1664525u + 1013904223u;
+			return (_state >> 8) / 16777216.0f;
+		}
+		
+		Imath::V3f nextVec3(){
+			float x = next();
+			float y = next();
+			float z = next();
+			return Imath::V3f(x, y, z);
+		}
+	
+	private:
+		unsigned int _state;
+	};
+	
+	template<class T>
+	T *createNode(const std::string &name, Node *parent){
+		T *node = new T(name, parent);
+		NodeAccessor::_setConstructorDone(*node, true);
+		parent->addNode(node);
+		
+		return node;
+	}
+	
+	NumericAttribute *numericAttribute(Node *node, const std::string &name){
+		return (NumericAttribute*)node->findAttribute(name);
+	}
+	
+	void setSpecialization(Node *node, const std::string &attributeName, const std::string &specialization){
+		Attribute *attribute = node->findAttribute(attributeName);
+		attribute->setSpecializationOverride(specialization);
+		attribute->forceSpecializationUpdate();
+	}
+	
+	void setFloat(Node *node, const std::string &attributeName, float value){
+		Attribute *attribute = node->findAttribute(attributeName);
+		((NumericAttribute*)attribute)->outValue()->setFloatValueAt(0, value);
+		attribute->valueChanged();
+	}
+	
+	void setString(Node *node, const std::string &attributeName, const std::string &value){
+		Attribute *attribute = node->findAttribute(attributeName);
+		((StringAttribute*)attribute)->outValue()->setStringValue(value);
+		attribute->valueChanged();
+	}
+	
+	AddNode *createFloatAddNode(const std::string &name, Node *parent){
+		AddNode *node = createNode<AddNode>(name, parent);
+		setSpecialization(node, "in0", "Float");
+		setSpecialization(node, "in1", "Float");
+		setSpecialization(node, "out", "Float");
+		
+		return node;
+	}
+	
+	//! Synthetic networks of AddNodes, head.in1 drives the whole network and sinks are the outputs cleaned on each iteration.
+	//! deep: a chain of nodes.
+	//! wide: every node reads the head directly.
+	//! diamond: a chain of diamonds, two nodes read the previous join and a third one joins them.
+	struct SyntheticNetwork{
+		Node *head;
+		std::vector<Attribute*> sinks;
+	};
+	
+	SyntheticNetwork buildSyntheticNetwork(const std::string &shape, int nodes, Node *parent){
+		SyntheticNetwork network;
+		network.head = createFloatAddNode("head", parent);
+		
+		Attribute *previous = network.head->findAttribute("out");
+		
+		if(shape == "deep"){
+			for(int i = 0; i < nodes; ++i){
+				Node *node = createFloatAddNode("chain", parent);
+				NetworkManager::connect(previous, node->findAttribute("in0"));
+				previous = node->findAttribute("out");
+			}
+			network.sinks.push_back(previous);
+		}
+		else if(shape == "wide"){
+			for(int i = 0; i < nodes; ++i){
+				Node *node = createFloatAddNode("branch", parent);
+				NetworkManager::connect(previous, node->findAttribute("in0"));
+				network.sinks.push_back(node->findAttribute("out"));
+			}
+		}
+		else if(shape == "diamond"){
+			for(int i = 0; i < nodes / 3; ++i){
+				Node *left = createFloatAddNode("left", parent);
+				Node *right = createFloatAddNode("right", parent);
+				Node *join = createFloatAddNode("join", parent);
+				
+				NetworkManager::connect(previous, left->findAttribute("in0"));
+				NetworkManager::connect(previous, right->findAttribute("in0"));
+				NetworkManager::connect(left->findAttribute("out"), join->findAttribute("in0"));
+				NetworkManager::connect(right->findAttribute("out"), join->findAttribute("in1"));
+				
+				previous = join->findAttribute("out");
+			}
+			network.sinks.push_back(previous);
+		}
+		
+		return network;
+	}
+	
+	void benchmarkSyntheticNetwork(const std::string &shape, int nodes, int iterations, std::vector<Result> &results){
+		std::map<std::string, double> parameters;
+		parameters["nodes"] = nodes;
+		
+		Samples loadSamples;
+		Samples cleanSamples;
+		Samples compiledSamples;
+		
+		for(int i = 0; i < 3; ++i){
+			Node *root = new Node("root", 0);
+			
+			Timer loadTimer;
+			NetworkManager::beginBatchEdit();
+			SyntheticNetwork network = buildSyntheticNetwork(shape, nodes, root);
+			NetworkManager::endBatchEdit();
+			Attribute::clean(network.sinks);
+			loadSamples.add(loadTimer.seconds());
+			
+			if(i == 0){
+				for(int j = 0; j < iterations; ++j){
+					Timer cleanTimer;
+					setFloat(network.head, "in1", float(j + 1));
+					Attribute::clean(network.sinks);
+					cleanSamples.add(cleanTimer.seconds());
+				}
+				
+				CompiledNetwork compiledNetwork;
+				compiledNetwork.compile(network.sinks);
+				for(int j = 0; j < iterations; ++j){
+					Timer compiledTimer;
+					setFloat(network.head, "in1", float(j + 1));
+					compiledNetwork.run();
+					compiledSamples.add(compiledTimer.seconds());
+				}
+			}
+			
+			root->deleteIt();
+		}
+		
+		results.push_back(loadSamples.result("network." + shape + ".load", parameters));
+		
+		parameters["iterations"] = iterations;
+		results.push_back(cleanSamples.result("network." + shape + ".dirtyClean", parameters));
+		results.push_back(compiledSamples.result("network." + shape + ".compiledRun", parameters));
+	}
+	
+	void benchmarkNumericOperation(NumericOperation::Operation operation, const std::string &operationName, int size, int iterations, std::vector<Result> &results){
+		Random random(1);
+		
+		std::vector<float> floatsA(size);
+		std::vector<float> floatsB(size);
+		std::vector<Imath::V3f> vec3sA(size);
+		std::vector<Imath::V3f> vec3sB(size);
+		for(int i = 0; i < size; ++i){
+			floatsA[i] = random.next();
+			floatsB[i] = random.next();
+			vec3sA[i] = random.nextVec3();
+			vec3sB[i] = random.nextVec3();
+		}
+		
+		std::map<std::string, double> parameters;
+		parameters["size"] = size;
+		
+		const char *typeNames[] = {"FloatArray", "Vec3Array"};
+		for(int typeId = 0; typeId < 2; ++typeId){
+			Numeric operandA;
+			Numeric operandB;
+			Numeric out;
+			
+			Numeric::Type type;
+			if(typeId == 0){
+				type = Numeric::numericTypeFloatArray;
+				operandA.setType(type);
+				operandB.setType(type);
+				operandA.setFloatValues(floatsA);
+				operandB.setFloatValues(floatsB);
+			}
+			else{
+				type = Numeric::numericTypeVec3Array;
+				operandA.setType(type);
+				operandB.setType(type);
+				operandA.setVec3Values(vec3sA);
+				operandB.setVec3Values(vec3sB);
+			}
+			out.setType(type);
+			
+			NumericOperation numericOperation;
+			numericOperation.setOperation(operation);
+			numericOperation.selectOperands(type, type);
+			
+			Samples samples;
+			for(int i = 0; i < iterations; ++i){
+				Timer timer;
+				numericOperation.executeSelectedOperation(&operandA, &operandB, &out, 0);
+				samples.add(timer.seconds());
+			}
+			
+			results.push_back(samples.result("numeric." + operationName + "." + typeNames[typeId], parameters));
+		}
+	}
+	
+	//! Forwarding a value from node to node, as ProcessSimulationNode or a passThrough do, 
+	//! and forwarding it to then write one of its elements.
+	void benchmarkNumericCopy(int size, int iterations, std::vector<Result> &results){
+		Random random(1);
+		
+		std::vector<Imath::V3f> vec3s(size);
+		for(int i = 0; i < size; ++i){
+			vec3s[i] = random.nextVec3();
+		}
+		
+		std::map<std::string, double> parameters;
+		parameters["size"] = size;
+		
+		Numeric source;
+		source.setType(Numeric::numericTypeVec3Array);
+		source.setVec3Values(vec3s);
+		
+		Samples copySamples;
+		Samples copyWriteSamples;
+		for(int i = 0; i < iterations; ++i){
+			Numeric forwarded;
+			
+			Timer copyTimer;
+			forwarded.copy(&source);
+			copySamples.add(copyTimer.seconds());
+			
+			Numeric written;
+			
+			Timer copyWriteTimer;
+			written.copy(&source);
+			written.setVec3ValueAt(0, Imath::V3f(0.0, 0.0, 0.0));
+			copyWriteSamples.add(copyWriteTimer.seconds());
+		}
+		
+		results.push_back(copySamples.result("numeric.copy.Vec3Array", parameters));
+		results.push_back(copyWriteSamples.result("numeric.copyWrite.Vec3Array", parameters));
+	}
+	
+	//! A grid of quads lying on xz, displaced along y by seed.
+	void buildGrid(int side, unsigned int seed, std::vector<Imath::V3f> &points, std::vector<std::vector<int> > &faces){
+		Random random(seed);
+		
+		points.resize((side + 1) * (side + 1));
+		for(int z = 0; z <= side; ++z){
+			for(int x = 0; x <= side; ++x){
+				points[z * (side + 1) + x] = Imath::V3f(float(x), random.next(), float(z));
+			}
+		}
+		
+		faces.resize(side * side);
+		for(int z = 0; z < side; ++z){
+			for(int x = 0; x < side; ++x){
+				std::vector<int> &face = faces[z * side + x];
+				face.resize(4);
+				face[0] = z * (side + 1) + x;
+				face[1] = (z + 1) * (side + 1) + x;
+				face[2] = (z + 1) * (side + 1) + x + 1;
+				face[3] = z * (side + 1) + x + 1;
+			}
+		}
+	}
+	
+	void benchmarkGeoNormals(int side, int iterations, std::vector<Result> &results){
+		std::vector<Imath::V3f> points;
+		std::vector<std::vector<int> > faces;
+		buildGrid(side, 1, points, faces);
+		
+		std::vector<Imath::V3f> displacedPoints;
+		std::vector<std::vector<int> > unusedFaces;
+		buildGrid(side, 2, displacedPoints, unusedFaces);
+		
+		std::map<std::string, double> parameters;
+		parameters["faces"] = faces.size();
+		parameters["points"] = points.size();
+		
+		Geo geo;
+		geo.build(points, faces);
+		
+		Samples faceSamples;
+		Samples vertexSamples;
+		for(int i = 0; i < iterations; ++i){
+			// setPoints invalidates the cached normals, alternate the points so each iteration computes them again
+			geo.setPoints(i % 2 ? points : displacedPoints);
+			
+			Timer faceTimer;
+			geo.faceNormals();
+			faceSamples.add(faceTimer.seconds());
+			
+			Timer vertexTimer;
+			geo.verticesNormals();
+			vertexSamples.add(vertexTimer.seconds());
+		}
+		
+		results.push_back(faceSamples.result("geo.faceNormals", parameters));
+		results.push_back(vertexSamples.result("geo.verticesNormals", parameters));
+	}
+	
+	void benchmarkFindPointsInRange(int size, float range, int iterations, std::vector<Result> &results){
+		Random random(1);
+		
+		std::vector<Imath::V3f> points(size);
+		for(int i = 0; i < size; ++i){
+			points[i] = random.nextVec3();
+		}
+		
+		Node *root = new Node("root", 0);
+		FindPointsInRange *node = createNode<FindPointsInRange>("findPointsInRange", root);
+		
+		NumericAttribute *pointsAttribute = numericAttribute(node, "points");
+		pointsAttribute->outValue()->setVec3Values(points);
+		pointsAttribute->valueChanged();
+		setFloat(node, "range", range);
+		
+		std::vector<Attribute*> outputs;
+		outputs.push_back(node->findAttribute("pointsInRange"));
+		outputs.push_back(node->findAttribute("pointsInRangeId"));
+		outputs.push_back(node->findAttribute("pointsInRangeSize"));
+		
+		NumericAttribute *pointAttribute = numericAttribute(node, "point");
+		
+		Samples samples;
+		for(int i = 0; i < iterations; ++i){
+			Timer timer;
+			pointAttribute->outValue()->setVec3ValueAt(0, random.nextVec3());
+			pointAttribute->valueChanged();
+			Attribute::clean(outputs);
+			samples.add(timer.seconds());
+		}
+		
+		root->deleteIt();
+		
+		std::map<std::string, double> parameters;
+		parameters["points"] = size;
+		parameters["range"] = range;
+		results.push_back(samples.result("kd.findPointsInRange", parameters));
+	}
+	
+	//! The network of examples/skinWeightCharacter/skinWeightNetwork.crl, playing the walk cycle.
+	void benchmarkSkinWeightDeformer(const std::string &examplesPath, int frames, std::vector<Result> &results){
+		std::string path = examplesPath + "/skinWeightCharacter/";
+		if(!std::ifstream((path + "geo.obj").c_str())){
+			std::cout << "* skipping skinWeightDeformer, can't find " << path << std::endl;
+			return;
+		}
+		
+		Node *root = new Node("root", 0);
+		
+		ObjImporter *objImporter = createNode<ObjImporter>("ObjImporter", root);
+		GetGeoPoints *getGeoPoints = createNode<GetGeoPoints>("GetGeoPoints", root);
+		SetGeoPoints *setGeoPoints = createNode<SetGeoPoints>("SetGeoPoints", root);
+		ImportCIOSkinWeights *skinWeights = createNode<ImportCIOSkinWeights>("ImportCIOSkinWeights", root);
+		ImportCIOTransforms *walk = createNode<ImportCIOTransforms>("walk", root);
+		ImportCIOTransforms *bindPose = createNode<ImportCIOTransforms>("bindPose", root);
+		SkinWeightDeformer *deformer = createNode<SkinWeightDeformer>("SkinWeightDeformer", root);
+		
+		setString(objImporter, "fileName", path + "geo.obj");
+		setString(skinWeights, "file", path + "skinWeights.cio");
+		setString(walk, "file", path + "anim.cio");
+		setString(bindPose, "file", path + "bindPose.cio");
+		setFloat(bindPose, "time", 3.0);
+		
+		NetworkManager::connect(objImporter->findAttribute("geo"), getGeoPoints->findAttribute("geo"));
+		NetworkManager::connect(objImporter->findAttribute("geo"), setGeoPoints->findAttribute("inGeo"));
+		NetworkManager::connect(skinWeights->findAttribute("vertices"), deformer->findAttribute("skinWeightVertices"));
+		NetworkManager::connect(skinWeights->findAttribute("deformers"), deformer->findAttribute("skinWeightDeformers"));
+		NetworkManager::connect(skinWeights->findAttribute("weights"), deformer->findAttribute("skinWeightValues"));
+		NetworkManager::connect(getGeoPoints->findAttribute("points"), deformer->findAttribute("points"));
+		NetworkManager::connect(walk->findAttribute("out"), deformer->findAttribute("deformers"));
+		NetworkManager::connect(bindPose->findAttribute("out"), deformer->findAttribute("bindPoseDeformers"));
+		NetworkManager::connect(deformer->findAttribute("outPoints"), setGeoPoints->findAttribute("points"));
+		
+		std::vector<Attribute*> outputs(1, setGeoPoints->findAttribute("outGeo"));
+		
+		// the first evaluation loads the files, it's timed on its own
+		Samples loadSamples;
+		Timer loadTimer;
+		Attribute::clean(outputs);
+		loadSamples.add(loadTimer.seconds());
+		
+		Samples frameSamples;
+		for(int i = 0; i < frames; ++i){
+			Timer timer;
+			setFloat(walk, "time", float(i));
+			Attribute::clean(outputs);
+			frameSamples.add(timer.seconds());
+		}
+		
+		std::map<std::string, double> parameters;
+		parameters["points"] = ((GeoAttribute*)setGeoPoints->findAttribute("outGeo"))->value()->points().size();
+		results.push_back(loadSamples.result("skinWeightCharacter.load", parameters));
+		
+		parameters["frames"] = frames;
+		results.push_back(frameSamples.result("skinWeightCharacter.frame", parameters));
+		
+		root->deleteIt();
+	}
+	
+	//! Adds a constant to each element of an array through a ForLoop and through a single AddNode working on the whole array,
+	//! the difference between the two is the cost of slicing.
+	void benchmarkForLoop(int size, int iterations, std::vector<Result> &results){
+		Random random(1);
+		std::vector<float> values(size);
+		for(int i = 0; i < size; ++i){
+			values[i] = random.next();
+		}
+		
+		Node *root = new Node("root", 0);
+		
+		ForLoopNode *forLoop = createNode<ForLoopNode>("ForLoop", root);
+		LoopInputNode *loopInput = createNode<LoopInputNode>("LoopInput", forLoop);
+		AddNode *add = createFloatAddNode("Add", forLoop);
+		LoopOutputNode *loopOutput = createNode<LoopOutputNode>("LoopOutput", forLoop);
+		
+		PassThroughAttribute *forLoopOutput = new PassThroughAttribute("output", forLoop);
+		AttributeAccessor::_setIsOutput(*forLoopOutput, true);
+		forLoop->addOutputAttribute(forLoopOutput);
+		forLoop->addDynamicAttribute(forLoopOutput);
+		
+		setSpecialization(forLoop, "globalArray", "FloatArray");
+		NetworkManager::connect(forLoop->findAttribute("globalArray"), loopInput->findAttribute("globalArray"));
+		NetworkManager::connect(loopInput->findAttribute("localElement"), add->findAttribute("in0"));
+		NetworkManager::connect(add->findAttribute("out"), loopOutput->findAttribute("localElement"));
+		NetworkManager::connect(loopOutput->findAttribute("globalArray"), forLoopOutput);
+		setFloat(add, "in1", 1.0);
+		
+		AddNode *arrayAdd = createNode<AddNode>("ArrayAdd", root);
+		setSpecialization(arrayAdd, "in0", "FloatArray");
+		setSpecialization(arrayAdd, "in1", "Float");
+		setSpecialization(arrayAdd, "out", "FloatArray");
+		setFloat(arrayAdd, "in1", 1.0);
+		
+		NumericAttribute *forLoopArray = numericAttribute(forLoop, "globalArray");
+		NumericAttribute *arrayAddArray = numericAttribute(arrayAdd, "in0");
+		std::vector<Attribute*> forLoopOutputs(1, forLoopOutput);
+		std::vector<Attribute*> arrayAddOutputs(1, arrayAdd->findAttribute("out"));
+		
+		Samples forLoopSamples;
+		Samples arrayAddSamples;
+		for(int i = 0; i < iterations; ++i){
+			values[i % size] += 1.0;
+			
+			forLoopArray->outValue()->setFloatValues(values);
+			forLoopArray->valueChanged();
+			Timer forLoopTimer;
+			Attribute::clean(forLoopOutputs);
+			forLoopSamples.add(forLoopTimer.seconds());
+			
+			arrayAddArray->outValue()->setFloatValues(values);
+			arrayAddArray->valueChanged();
+			Timer arrayAddTimer;
+			Attribute::clean(arrayAddOutputs);
+			arrayAddSamples.add(arrayAddTimer.seconds());
+		}
+		
+		root->deleteIt();
+		
+		std::map<std::string, double> parameters;
+		parameters["size"] = size;
+		results.push_back(forLoopSamples.result("loop.forLoopAdd", parameters));
+		results.push_back(arrayAddSamples.result("loop.arrayAdd", parameters));
+	}
+	
+	std::string jsonString(const std::string &value){
+		std::string str = "\"";
+		for(int i = 0; i < value.size(); ++i){
+			char c = value[i];
+			if(c == '"' || c == '\\'){
+				str += '\\';
+			}
+			str += c;
+		}
+		str += "\"";
+		
+		return str;
+	}
+	
+	void writeJson(const std::vector<Result> &results, std::ostream &stream){
+		stream.precision(9);
+		
+		stream << "{" << std::endl;
+		
+		#ifdef CORAL_PARALLEL_TBB
+			stream << "  \"parallel\": \"tbb\"," << std::endl;
+		#else
+			stream << "  \"parallel\": \"none\"," << std::endl;
+		#endif
+		
+		stream << "  \"benchmarks\": [" << std::endl;
+		for(int i = 0; i < results.size(); ++i){
+			const Result &result = results[i];
+			
+			stream << "    {\"name\": " << jsonString(result.name) << ", \"parameters\": {";
+			for(std::map<std::string, double>::const_iterator it = result.parameters.begin(); it != result.parameters.end(); ++it){
+				if(it != result.parameters.begin()){
+					stream << ", ";
+				}
+				stream << jsonString(it->first) << ": " << it->second;
+			}
+			stream << "}, \"iterations\": " << result.iterations;
+			stream << ", \"minSeconds\": " << result.minSeconds;
+			stream << ", \"meanSeconds\": " << result.meanSeconds << "}";
+			
+			if(i < results.size() - 1){
+				stream << ",";
+			}
+			stream << std::endl;
+		}
+		stream << "  ]" << std::endl;
+		stream << "}" << std::endl;
+	}
+	
+	//! Runs every workload and writes the results to outputFilename as json, 
+	//! the skinWeightCharacter workload is skipped if examplesPath doesn't contain it.
+	bool run(const std::string &outputFilename, const std::string &examplesPath){
+		// disable python ref counting before running benchmarks
+		Object::_addReferenceCallback = 0;
+		Object::_removeReferenceCallback = 0;
+		
+		std::cout << "* running c++ benchmarks..." << std::endl;
+		
+		std::vector<Result> results;
+		
+		benchmarkSyntheticNetwork("deep", 10000, 100, results);
+		benchmarkSyntheticNetwork("wide", 10000, 100, results);
+		benchmarkSyntheticNetwork("diamond", 10000, 100, results);
+		
+		benchmarkNumericOperation(NumericOperation::numericOperationAdd, "add", 1000000, 20, results);
+		benchmarkNumericOperation(NumericOperation::numericOperationMul, "mul", 1000000, 20, results);
+		benchmarkNumericCopy(1000000, 20, results);
+		
+		benchmarkGeoNormals(1000, 6, results);
+		
+		benchmarkFindPointsInRange(100000, 0.05, 20, results);
+		
+		benchmarkSkinWeightDeformer(examplesPath, 50, results);
+		
+		benchmarkForLoop(100000, 10, results);
+		
+		std::ofstream file(outputFilename.c_str());
+		if(!file){
+			std::cout << "* can't write " << outputFilename << std::endl;
+			return false;
+		}
+		
+		writeJson(results, file);
+		
+		std::cout << "* c++ benchmarks done, results written to " << outputFilename << std::endl;
+		
+		return true;
+	}
+}
+
+#endif
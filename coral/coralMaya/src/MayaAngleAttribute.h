@@ -83,7 +83,7 @@ public:
 	
 	virtual void transferValueToMaya(MPlug &plug, MDataBlock &data){
 		MArrayDataHandle arrayHandle = data.outputArrayValue(plug);
-		const std::vector<Imath::V3f> &values = value()->vec3Values();
+		coral::SliceView<Imath::V3f> values = value()->vec3Values();
 		int minCount = arrayHandle.elementCount();
 		if(values.size() < minCount){
 			minCount = values.size();
@@ -61,7 +61,7 @@ void MayaMatrixAttribute::transferValueFromMaya(MPlug &plug, MDataBlock &data){
 
 void MayaMatrixArrayAttribute::transferValueToMaya(MPlug &plug, MDataBlock &data){
 	MArrayDataHandle arrayHandle = data.outputArrayValue(plug);
-	const std::vector<Imath::M44f> &values = value()->matrix44Values();
+	coral::SliceView<Imath::M44f> values = value()->matrix44Values();
 	int minCount = arrayHandle.elementCount();
 	if(values.size() < minCount){
 		minCount = values.size();
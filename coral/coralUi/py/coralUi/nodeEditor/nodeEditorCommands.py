@@ -113,7 +113,11 @@ class Paste(Command):
         coralApp.CoralAppData.appendToLastCreatedNodes = True
         coralApp.CoralAppData.loadingNetwork = True
         coralApp.setUndoLimit(0)
-        exec(script)
+        coralApp.beginBatchEdit()
+        try:
+            exec(script)
+        finally:
+            coralApp.endBatchEdit()
         coralApp.setUndoLimit(100)
         coralApp.CoralAppData.loadingNetwork = False
         coralApp.CoralAppData.appendToLastCreatedNodes = False
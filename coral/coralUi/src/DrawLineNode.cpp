@@ -151,7 +151,7 @@ void DrawLineNode::initShader(){
 
 void DrawLineNode::updatePointValues(unsigned int slice){
 	Numeric *vec3Numeric = _points->value();
-	const std::vector<Imath::V3f> &vec3Values = vec3Numeric->vec3ValuesSlice(slice);
+	SliceView<Imath::V3f> vec3Values = vec3Numeric->vec3ValuesSlice(slice);
 
 	// vertex buffer
 	glBindBuffer(GL_ARRAY_BUFFER, _pointBuffer);
@@ -163,13 +163,13 @@ void DrawLineNode::updatePointValues(unsigned int slice){
 
 void DrawLineNode::updateColorValues(unsigned int slice){
 	Numeric *col4Numeric = _colors->value();
-	const std::vector<Imath::Color4f> &col4Values = col4Numeric->col4ValuesSlice(slice);
+	SliceView<Imath::Color4f> col4Values = col4Numeric->col4ValuesSlice(slice);
 
 	// color buffer
 	if(col4Numeric->isArray() && col4Values.size() > 0){
 		// avoid empty color (and maybe crashs)
 		Numeric *vec3Numeric = _points->value();
-		const std::vector<Imath::V3f> &vec3Values = vec3Numeric->vec3ValuesSlice(slice);
+		SliceView<Imath::V3f> vec3Values = vec3Numeric->vec3ValuesSlice(slice);
 		int pointCount = (int)vec3Values.size();
 		int colorCount = (int)col4Values.size();
 
@@ -200,11 +200,11 @@ void DrawLineNode::drawLines(unsigned int slice){
 	Numeric *thicknessNumeric = _thickness->value();
 	GLfloat lineWith = 1.0;
 	if(thicknessNumeric->type() == Numeric::numericTypeInt){
-		const std::vector<int> &intValues = thicknessNumeric->intValuesSlice(slice);
+		SliceView<int> intValues = thicknessNumeric->intValuesSlice(slice);
 		lineWith = (GLfloat) intValues[0];
 	}
 	else if (thicknessNumeric->type() == Numeric::numericTypeFloat){
-		const std::vector<float> &floatValues = thicknessNumeric->floatValuesSlice(slice);
+		SliceView<float> floatValues = thicknessNumeric->floatValuesSlice(slice);
 		lineWith = (GLfloat) floatValues[0];
 	}
 
@@ -240,7 +240,7 @@ void DrawLineNode::drawLines(unsigned int slice){
 	glEnableClientState(GL_VERTEX_ARRAY);
 
 	// render
-	const std::vector<Imath::V3f> &points = _points->value()->vec3ValuesSlice(slice);
+	SliceView<Imath::V3f> points = _points->value()->vec3ValuesSlice(slice);
 	glDrawArrays(GL_LINE_STRIP, 0, points.size());
 	
 	// clean OpenGL statement
@@ -255,7 +255,7 @@ void DrawLineNode::drawLines(unsigned int slice){
 
 void DrawLineNode::drawSlice(unsigned int slice){
 	Numeric *points = _points->value();
-	const std::vector<Imath::V3f> &vec3Values = points->vec3ValuesSlice(slice);
+	SliceView<Imath::V3f> vec3Values = points->vec3ValuesSlice(slice);
 
 	if(vec3Values.size() == 0)
 		return;
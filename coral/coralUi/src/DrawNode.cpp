@@ -79,7 +79,7 @@ void DrawNode::initGL(){
 }
 
 void DrawNode::attributeDirtied(Attribute *attribute){
-	MainDrawRoutine::scheduleRender();
+	MainDrawRoutine::scheduleRender(attribute);
 }
 
 void DrawNode::attributeConnectionChanged(Attribute *attribute){
@@ -161,14 +161,14 @@ void DrawPointNode::initShader(){
 	_colorIndexAttr = glGetAttribLocation(_shaderProgram, "in_Color");
 }
 
-void DrawPointNode::updatePointValues(unsigned int slice, const std::vector<Imath::V3f> &points){
+void DrawPointNode::updatePointValues(unsigned int slice, const SliceView<Imath::V3f> &points){
 	glBindBuffer(GL_ARRAY_BUFFER, _pointBuffer);
 	glBufferData(GL_ARRAY_BUFFER, 3*sizeof(GLfloat)*points.size(), (GLvoid*)&points[0].x, GL_STATIC_DRAW);
 	
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
-void DrawPointNode::updateSizeValues(unsigned int slice, const std::vector<Imath::V3f> &points, const std::vector<float> &sizes){
+void DrawPointNode::updateSizeValues(unsigned int slice, const SliceView<Imath::V3f> &points, const SliceView<float> &sizes){
 	int sizeCount = sizes.size();
 	int pointCount = points.size();
 
@@ -196,7 +196,7 @@ void DrawPointNode::updateSizeValues(unsigned int slice, const std::vector<Imath
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
-void DrawPointNode::updateColorValues(unsigned int slice, const std::vector<Imath::V3f> &points, const std::vector<Imath::Color4f> &colors){
+void DrawPointNode::updateColorValues(unsigned int slice, const SliceView<Imath::V3f> &points, const SliceView<Imath::Color4f> &colors){
 	int colorCount = colors.size();
 	int pointCount = points.size();
 
@@ -224,7 +224,7 @@ void DrawPointNode::updateColorValues(unsigned int slice, const std::vector<Imat
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
-void DrawPointNode::drawPoints(unsigned int slice, const std::vector<Imath::V3f> &points){
+void DrawPointNode::drawPoints(unsigned int slice, const SliceView<Imath::V3f> &points){
 	int pointCount = points.size();
 
 	glUseProgram(_shaderProgram);
@@ -256,13 +256,13 @@ void DrawPointNode::drawPoints(unsigned int slice, const std::vector<Imath::V3f>
 }
 
 void DrawPointNode::drawSlice(unsigned int slice){
-	const std::vector<Imath::V3f> &points = _points->value()->vec3ValuesSlice(slice);
+	SliceView<Imath::V3f> points = _points->value()->vec3ValuesSlice(slice);
 	unsigned int pointsCount = points.size();
 	if(pointsCount == 0)
 		return;
 
-	const std::vector<Imath::Color4f> &colors = _colors->value()->col4ValuesSlice(slice);
-	const std::vector<float> &sizes = _sizes->value()->floatValuesSlice(slice);
+	SliceView<Imath::Color4f> colors = _colors->value()->col4ValuesSlice(slice);
+	SliceView<float> sizes = _sizes->value()->floatValuesSlice(slice);
 
 	updatePointValues(slice, points);
 	updateSizeValues(slice, points, sizes);
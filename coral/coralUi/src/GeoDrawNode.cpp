@@ -231,7 +231,7 @@ void GeoDrawNode::updateGeoVBO(){
 
 void GeoDrawNode::updateColorVBO(){
 	Numeric *col4Numeric = _colors->value();
-	const std::vector<Imath::Color4f> &col4Values = col4Numeric->col4Values();
+	SliceView<Imath::Color4f> col4Values = col4Numeric->col4Values();
 
 	/////////////////////////
 	// color buffer
@@ -335,7 +335,7 @@ void GeoDrawNode::drawSurface(Geo *geo, bool smooth){
 	}
 
 	Numeric *col4Numeric = _colors->value();
-	const std::vector<Imath::Color4f> &col4Values = col4Numeric->col4Values();
+	SliceView<Imath::Color4f> col4Values = col4Numeric->col4Values();
 
 	bool useColVbo = false;
 	if(col4Numeric->type() == Numeric::numericTypeCol4Array){
@@ -101,7 +101,7 @@ void MainDrawRoutine::dirtyingDoneCallback(Attribute *attribute){
 	}
 }
 
-void MainDrawRoutine::scheduleRender(){
+void MainDrawRoutine::scheduleRender(Attribute *attribute){
 	if(_initialized){
 		if(!_renderScheduled){
 			#ifdef CORAL_PARALLEL_TBB
@@ -109,7 +109,7 @@ void MainDrawRoutine::scheduleRender(){
 			#endif
 			_renderScheduled = true;
 			
-			Attribute::queueDirtyingDoneCallback(&MainDrawRoutine::dirtyingDoneCallback);
+			attribute->queueDirtyingDoneCallback(&MainDrawRoutine::dirtyingDoneCallback);
 		}
 	}
 }
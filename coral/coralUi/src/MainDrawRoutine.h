@@ -43,7 +43,7 @@ public:
 	static void addDrawNode(DrawNode *drawNode);
 	static void removeDrawNode(DrawNode *drawNode);
 	static void drawAll();
-	static void scheduleRender();
+	static void scheduleRender(coral::Attribute *attribute);
 		
 	static void(*_viewportRefreshCallback)(void);
 
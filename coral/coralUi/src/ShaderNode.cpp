@@ -46,7 +46,7 @@ namespace {
 		}
 
 		void update(int pointsCount){
-			const std::vector<float> &values = _attribute->value()->floatValues();
+			SliceView<float> values = _attribute->value()->floatValues();
 
 			glBindBuffer(GL_ARRAY_BUFFER, _vbo);
 			glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat)*pointsCount, (GLvoid*)&values[0], GL_STATIC_DRAW);